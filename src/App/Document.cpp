@@ -533,6 +533,17 @@ void Document::_commitTransaction(bool notify)
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
         }
+        if (d->UndoMemSize > 0) {
+            // drop the oldest transactions until the stack fits into the memory budget
+            // but always keep the one just committed
+            unsigned int size = getUndoMemSize();
+            while (size > d->UndoMemSize && mUndoTransactions.size() > 1) {
+                size -= mUndoTransactions.front()->getMemSize();
+                mUndoMap.erase(mUndoTransactions.front()->getID());
+                delete mUndoTransactions.front();
+                mUndoTransactions.pop_front();
+            }
+        }
         signalCommitTransaction(*this);
 
         // closeActiveTransaction() may call again _commitTransaction()
@@ -647,7 +658,9 @@ void Document::clearDocument()
     d->clearRecomputeLog();
     d->objectArray.clear();
     d->objectMap.clear();
+    d->objectNameSuffixes.clear();
     d->objectIdMap.clear();
+    DocumentObject::clearRecursiveListCache();
     d->lastObjectId = 0;
 }
 
@@ -745,7 +758,14 @@ int Document::getUndoMode() const
 
 unsigned int Document::getUndoMemSize() const
 {
-    return d->UndoMemSize;
+    unsigned int size = 0;
+    for (auto trans : mUndoTransactions) {
+        size += trans->getMemSize();
+    }
+    for (auto trans : mRedoTransactions) {
+        size += trans->getMemSize();
+    }
+    return size;
 }
 
 void Document::setUndoLimit(unsigned int UndoMemSize)
@@ -753,6 +773,11 @@ void Document::setUndoLimit(unsigned int UndoMemSize)
     d->UndoMemSize = UndoMemSize;
 }
 
+unsigned int Document::getUndoLimit() const
+{
+    return d->UndoMemSize;
+}
+
 void Document::setMaxUndoStackSize(unsigned int UndoMaxStackSize)
 {
     d->UndoMaxStackSize = UndoMaxStackSize;
@@ -848,9 +873,57 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
 
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
+    if (d->batchChanges > 0 && What->hasName()) {
+        auto res = d->batchedChangeIndex.emplace(Who->getID(), d->batchedChanges.size());
+        if (res.second) {
+            d->batchedChanges.emplace_back(Who->getID(), std::vector<std::string>());
+        }
+        auto& names = d->batchedChanges[res.first->second].second;
+        if (std::find(names.begin(), names.end(), What->getName()) == names.end()) {
+            names.emplace_back(What->getName());
+        }
+        return;
+    }
     signalChangedObject(*Who, *What);
 }
 
+void Document::onChangedLabel(const DocumentObject* Who)
+{
+    d->updateObjectLabel(Who);
+}
+
+void Document::beginBatchChanges()
+{
+    ++d->batchChanges;
+}
+
+void Document::endBatchChanges()
+{
+    if (d->batchChanges <= 0 || --d->batchChanges > 0) {
+        return;
+    }
+
+    auto changes = std::move(d->batchedChanges);
+    d->batchedChanges.clear();
+    d->batchedChangeIndex.clear();
+    for (const auto& change : changes) {
+        DocumentObject* obj = getObjectByID(change.first);
+        if (!obj) {
+            continue;
+        }
+        for (const auto& name : change.second) {
+            if (Property* prop = obj->getPropertyByName(name.c_str())) {
+                signalChangedObject(*obj, *prop);
+            }
+        }
+    }
+}
+
+bool Document::isBatchingChanges() const
+{
+    return d->batchChanges > 0;
+}
+
 void Document::setTransactionMode(int iMode)
 {
     d->iTransactionMode = iMode;
@@ -2186,9 +2259,12 @@ bool Document::saveToFile(const char* filename) const
 
         writer.setComment("FreeCAD Document");
         writer.setLevel(compression);
+        writer.setParallel(hGrp->GetBool("SaveParallel", true));
         writer.putNextEntry("Document.xml");
 
-        if (hGrp->GetBool("SaveBinaryBrep", false)) {
+        // The binary format is smaller and much faster to read than the text BREP.
+        // Files are restored by their extension, so both formats can be mixed.
+        if (hGrp->GetBool("SaveBinaryBrep", true)) {
             writer.setMode("BinaryBrep");
         }
 
@@ -2278,7 +2354,9 @@ void Document::restore(const char* filename,
     d->clearRecomputeLog();
     d->objectArray.clear();
     d->objectMap.clear();
+    d->objectNameSuffixes.clear();
     d->objectIdMap.clear();
+    DocumentObject::clearRecursiveListCache();
     d->lastObjectId = 0;
 
     if (signal) {
@@ -2306,6 +2384,10 @@ void Document::restore(const char* filename,
     if (!reader.isValid()) {
         throw Base::FileException("Error reading compression file", filename);
     }
+    reader.setParallelDecode(
+        App::GetApplication()
+            .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+            ->GetBool("RestoreParallel", true));
 
     GetApplication().signalStartRestoreDocument(*this);
     setStatus(Document::Restoring, true);
@@ -3583,14 +3665,12 @@ DocumentObject* Document::addObject(const char* sType,
 
     d->activeObject = pcObject;
 
-    // insert in the name map
-    d->objectMap[ObjectName] = pcObject;
+    // insert in the name map and cache the pointer to the name string in the
+    // Object (for performance of DocumentObject::getNameInDocument())
+    pcObject->pcNameInDocument = d->addObjectName(ObjectName, pcObject);
     // generate object id and add to id map;
     pcObject->_Id = ++d->lastObjectId;
     d->objectIdMap[pcObject->_Id] = pcObject;
-    // cache the pointer to the name string in the Object (for performance of
-    // DocumentObject::getNameInDocument())
-    pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
 
@@ -3653,12 +3733,10 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
         return objects;
     }
 
-    // get all existing object names
-    std::vector<std::string> reservedNames;
-    reservedNames.reserve(d->objectMap.size());
-    for (const auto& pos : d->objectMap) {
-        reservedNames.push_back(pos.first);
-    }
+    // reserve the storage for all objects at once
+    d->objectArray.reserve(d->objectArray.size() + objects.size());
+    d->objectMap.reserve(d->objectMap.size() + objects.size());
+    d->objectIdMap.reserve(d->objectIdMap.size() + objects.size());
 
     for (auto it = objects.begin(); it != objects.end(); ++it) {
         auto index = std::distance(objects.begin(), it);
@@ -3690,19 +3768,17 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
                 }
             }
 
-            ObjectName = Base::Tools::getUniqueName(ObjectName, reservedNames, 3);
+            ObjectName = Base::Tools::getUniqueName(ObjectName,
+                                                    d->getUniqueNameCandidates(ObjectName),
+                                                    3);
         }
 
-        reservedNames.push_back(ObjectName);
-
-        // insert in the name map
-        d->objectMap[ObjectName] = pcObject;
+        // insert in the name map and cache the pointer to the name string in the
+        // Object (for performance of DocumentObject::getNameInDocument())
+        pcObject->pcNameInDocument = d->addObjectName(ObjectName, pcObject);
         // generate object id and add to id map;
         pcObject->_Id = ++d->lastObjectId;
         d->objectIdMap[pcObject->_Id] = pcObject;
-        // cache the pointer to the name string in the Object (for performance of
-        // DocumentObject::getNameInDocument())
-        pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
         // insert in the vector
         d->objectArray.push_back(pcObject);
 
@@ -3713,12 +3789,16 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
             pcObject->setupObject();
         }
 
-        // mark the object as new (i.e. set status bit 2) and send the signal
+        // mark the object as new (i.e. set status bit 2)
         pcObject->setStatus(ObjectStatus::New, true);
 
         const char* viewType = pcObject->getViewProviderNameOverride();
         pcObject->_pcViewProviderName = viewType ? viewType : "";
+    }
 
+    // send the signals once all objects are registered so that observers see
+    // the complete batch
+    for (auto pcObject : objects) {
         signalNewObject(*pcObject);
 
         // do no transactions if we do a rollback!
@@ -3763,16 +3843,14 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
 
     d->activeObject = pcObject;
 
-    // insert in the name map
-    d->objectMap[ObjectName] = pcObject;
+    // insert in the name map and cache the pointer to the name string in the
+    // Object (for performance of DocumentObject::getNameInDocument())
+    pcObject->pcNameInDocument = d->addObjectName(ObjectName, pcObject);
     // generate object id and add to id map;
     if (!pcObject->_Id) {
         pcObject->_Id = ++d->lastObjectId;
     }
     d->objectIdMap[pcObject->_Id] = pcObject;
-    // cache the pointer to the name string in the Object (for performance of
-    // DocumentObject::getNameInDocument())
-    pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
 
@@ -3797,16 +3875,15 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
 void Document::_addObject(DocumentObject* pcObject, const char* pObjectName)
 {
     std::string ObjectName = getUniqueObjectName(pObjectName);
-    d->objectMap[ObjectName] = pcObject;
+    // cache the pointer to the name string in the Object (for performance of
+    // DocumentObject::getNameInDocument())
+    pcObject->pcNameInDocument = d->addObjectName(ObjectName, pcObject);
     // generate object id and add to id map;
     if (!pcObject->_Id) {
         pcObject->_Id = ++d->lastObjectId;
     }
     d->objectIdMap[pcObject->_Id] = pcObject;
     d->objectArray.push_back(pcObject);
-    // cache the pointer to the name string in the Object (for performance of
-    // DocumentObject::getNameInDocument())
-    pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
 
     // do no transactions if we do a rollback!
     if (!d->rollback) {
@@ -3932,7 +4009,7 @@ void Document::removeObject(const char* sName)
     if (tobedestroyed) {
         tobedestroyed->pcNameInDocument = nullptr;
     }
-    d->objectMap.erase(pos);
+    d->removeObjectName(pos);
 }
 
 /// Remove an object out of the document (internal)
@@ -4001,7 +4078,7 @@ void Document::_removeObject(DocumentObject* pcObject)
     // remove from map
     pcObject->setStatus(ObjectStatus::Remove, false);  // Unset the bit to be on the safe side
     d->objectIdMap.erase(pcObject->_Id);
-    d->objectMap.erase(pos);
+    d->removeObjectName(pos);
 
     for (std::vector<DocumentObject*>::iterator it = d->objectArray.begin();
          it != d->objectArray.end();
@@ -4301,15 +4378,15 @@ std::string Document::getUniqueObjectName(const char* Name) const
             }
         }
 
-        std::vector<std::string> names;
-        names.reserve(d->objectMap.size());
-        for (pos = d->objectMap.begin(); pos != d->objectMap.end(); ++pos) {
-            names.push_back(pos->first);
-        }
-        return Base::Tools::getUniqueName(CleanName, names, 3);
+        return Base::Tools::getUniqueName(CleanName, d->getUniqueNameCandidates(CleanName), 3);
     }
 }
 
+bool Document::containsLabel(const std::string& label) const
+{
+    return d->objectLabels.find(label) != d->objectLabels.end();
+}
+
 std::string Document::getStandardObjectName(const char* Name, int d) const
 {
     std::vector<App::DocumentObject*> mm = getObjects();
@@ -274,6 +274,10 @@ public:
      * @param objectNames A list of object names
      * @param isNew       If false don't call the \c DocumentObject::setupObject() callback (default
      * is true)
+     *
+     * The storage for all objects is reserved up front and signalNewObject is sent
+     * after all objects have been added, so this is much faster than calling
+     * addObject() repeatedly when creating many objects of the same type.
      */
     std::vector<DocumentObject*>
     addObjects(const char* sType, const std::vector<std::string>& objectNames, bool isNew = true);
@@ -322,6 +326,8 @@ public:
     const char* getObjectName(DocumentObject* pFeat) const;
     /// Returns a Name of an Object or 0
     std::string getUniqueObjectName(const char* Name) const;
+    /// Check if an object of the document has the given label
+    bool containsLabel(const std::string& label) const;
     /// Returns a name of the form prefix_number. d specifies the number of digits.
     std::string getStandardObjectName(const char* Name, int d) const;
     /// Returns a list of document's objects including the dependencies
@@ -425,8 +431,10 @@ public:
     /// Check if a transaction is open and its list is empty.
     /// If no transaction is open true is returned.
     bool isTransactionEmpty() const;
-    /// Set the Undo limit in Byte!
+    /// Set the Undo limit in Byte! 0 means no limit.
     void setUndoLimit(unsigned int UndoMemSize = 0);
+    /// Returns the Undo limit in Byte
+    unsigned int getUndoLimit() const;
     /// Returns the actual memory consumption of the Undo redo stuff.
     unsigned int getUndoMemSize() const;
     /// Set the Undo limit as stack size
@@ -454,6 +462,20 @@ public:
     void addOrRemovePropertyOfObject(TransactionalObject*, Property* prop, bool add);
     //@}
 
+    /** @name Batching of change notifications
+     *
+     * While a batch is active signalChangedObject is not emitted for every
+     * property change. The changes are collected instead and emitted once per
+     * changed property of each object, grouped by object, when the outermost
+     * batch ends. Changes of objects or properties that are removed in the
+     * meantime are dropped. Batches can be nested.
+     */
+    //@{
+    void beginBatchChanges();
+    void endBatchChanges();
+    bool isBatchingChanges() const;
+    //@}
+
     /** @name dependency stuff */
     //@{
     /// write GraphViz file
@@ -600,6 +622,8 @@ protected:
     void onBeforeChangeProperty(const TransactionalObject* Who, const Property* What);
     /// callback from the Document objects after property was changed
     void onChangedProperty(const DocumentObject* Who, const Property* What);
+    /// callback from the Document objects after the label was changed
+    void onChangedLabel(const DocumentObject* Who);
     /// helper which Recompute only this feature
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
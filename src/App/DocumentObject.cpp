@@ -24,7 +24,10 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <atomic>
+#include <mutex>
 #include <stack>
+#include <unordered_set>
 #endif
 
 #include <App/DocumentObjectPy.h>
@@ -59,6 +62,17 @@ PROPERTY_SOURCE(App::DocumentObject, App::TransactionalObject)
 
 DocumentObjectExecReturn* DocumentObject::StdReturn = nullptr;
 
+namespace
+{
+// Version of the link graph of all documents, incremented on every change of a
+// link. A cached recursive in or out list is valid if its version matches.
+std::atomic<std::size_t> LinkGraphVersion {1};
+// Protects the cached recursive lists so that they can be queried concurrently
+std::mutex RecursiveListMutex;
+// Objects holding cached recursive lists, so that they can be released on a change
+std::unordered_set<const App::DocumentObject*> ObjectsWithRecursiveLists;
+}  // namespace
+
 //===========================================================================
 // DocumentObject
 //===========================================================================
@@ -95,6 +109,8 @@ DocumentObject::~DocumentObject()
         // Call before decrementing the reference counter, otherwise a heap error can occur
         obj->setInvalid();
     }
+    // the object may still be in the cached recursive lists of other objects
+    clearRecursiveListCache();
 }
 
 void DocumentObject::printInvalidLinks() const
@@ -396,6 +412,7 @@ const char* DocumentObject::detachFromDocument()
 {
     const std::string* name = pcNameInDocument;
     pcNameInDocument = nullptr;
+    clearRecursiveListCache();
     return name ? name->c_str() : nullptr;
 }
 
@@ -494,10 +511,57 @@ const std::vector<App::DocumentObject*>& DocumentObject::getInList() const
 
 std::vector<App::DocumentObject*> DocumentObject::getInListRecursive() const
 {
+#ifndef USE_OLD_DAG
+    std::lock_guard<std::mutex> lock(RecursiveListMutex);
+    _updateInListRecursive();
+    return _inListRecursive;
+#else
     std::set<App::DocumentObject*> inSet;
     std::vector<App::DocumentObject*> res;
     getInListEx(inSet, true, &res);
     return res;
+#endif
+}
+
+void DocumentObject::clearRecursiveListCache()
+{
+    std::lock_guard<std::mutex> lock(RecursiveListMutex);
+    ++LinkGraphVersion;
+    // all cached lists are stale now, so don't keep them until the next query
+    for (auto obj : ObjectsWithRecursiveLists) {
+        obj->_inListRecursive.clear();
+        obj->_inListRecursive.shrink_to_fit();
+        obj->_inSetRecursive.clear();
+        obj->_outListRecursive.clear();
+        obj->_outListRecursive.shrink_to_fit();
+    }
+    ObjectsWithRecursiveLists.clear();
+}
+
+// Must be called with RecursiveListMutex held
+void DocumentObject::_updateInListRecursive() const
+{
+    std::size_t version = LinkGraphVersion;
+    if (_inListRecursiveVersion == version) {
+        return;
+    }
+
+    _inListRecursive.clear();
+    _inSetRecursive.clear();
+    std::stack<DocumentObject*> pendings;
+    pendings.push(const_cast<DocumentObject*>(this));
+    while (!pendings.empty()) {
+        auto obj = pendings.top();
+        pendings.pop();
+        for (auto o : obj->getInList()) {
+            if (o && o->isAttachedToDocument() && _inSetRecursive.insert(o).second) {
+                pendings.push(o);
+                _inListRecursive.push_back(o);
+            }
+        }
+    }
+    _inListRecursiveVersion = version;
+    ObjectsWithRecursiveLists.insert(this);
 }
 
 
@@ -551,6 +615,17 @@ void DocumentObject::getInListEx(std::set<App::DocumentObject*>& inSet,
         return;
     }
 
+    if (inSet.empty()) {
+        std::lock_guard<std::mutex> lock(RecursiveListMutex);
+        _updateInListRecursive();
+        inSet = _inSetRecursive;
+        if (inList) {
+            inList->insert(inList->end(), _inListRecursive.begin(), _inListRecursive.end());
+        }
+        return;
+    }
+
+    // Objects already in inSet are not followed, so the cache cannot be used
     std::stack<DocumentObject*> pendings;
     pendings.push(const_cast<DocumentObject*>(this));
     while (!pendings.empty()) {
@@ -598,6 +673,12 @@ void _getOutListRecursive(std::set<DocumentObject*>& objSet,
 
 std::vector<App::DocumentObject*> DocumentObject::getOutListRecursive() const
 {
+    std::lock_guard<std::mutex> lock(RecursiveListMutex);
+    std::size_t version = LinkGraphVersion;
+    if (_outListRecursiveVersion == version) {
+        return _outListRecursive;
+    }
+
     // number of objects in document is a good estimate in result size
     int maxDepth = GetApplication().checkLinkDepth(0);
     std::set<App::DocumentObject*> result;
@@ -605,9 +686,11 @@ std::vector<App::DocumentObject*> DocumentObject::getOutListRecursive() const
     // using a recursive helper to collect all OutLists
     _getOutListRecursive(result, this, this, maxDepth);
 
-    std::vector<App::DocumentObject*> array;
-    array.insert(array.begin(), result.begin(), result.end());
-    return array;
+    // the set is ordered, so the cached list can be used for a binary search
+    _outListRecursive.assign(result.begin(), result.end());
+    _outListRecursiveVersion = version;
+    ObjectsWithRecursiveLists.insert(this);
+    return _outListRecursive;
 }
 
 // helper for isInInListRecursive()
@@ -639,7 +722,16 @@ bool _isInInListRecursive(const DocumentObject* act, const DocumentObject* check
 
 bool DocumentObject::isInInListRecursive(DocumentObject* linkTo) const
 {
-    return this == linkTo || getInListEx(true).count(linkTo);
+    if (this == linkTo) {
+        return true;
+    }
+#ifndef USE_OLD_DAG
+    std::lock_guard<std::mutex> lock(RecursiveListMutex);
+    _updateInListRecursive();
+    return _inSetRecursive.count(linkTo) > 0;
+#else
+    return getInListEx(true).count(linkTo);
+#endif
 }
 
 bool DocumentObject::isInInList(DocumentObject* linkTo) const
@@ -686,6 +778,13 @@ bool _isInOutListRecursive(const DocumentObject* act, const DocumentObject* chec
 
 bool DocumentObject::isInOutListRecursive(DocumentObject* linkTo) const
 {
+    {
+        std::lock_guard<std::mutex> lock(RecursiveListMutex);
+        if (_outListRecursiveVersion == LinkGraphVersion) {
+            return std::binary_search(_outListRecursive.begin(), _outListRecursive.end(), linkTo);
+        }
+    }
+
     int maxDepth = getDocument()->countObjects() + 2;
     return _isInOutListRecursive(this, linkTo, maxDepth);
 }
@@ -710,8 +809,16 @@ bool DocumentObject::testIfLinkDAGCompatible(DocumentObject* linkTo) const
 
 bool DocumentObject::testIfLinkDAGCompatible(const std::vector<DocumentObject*>& linksTo) const
 {
+    if (std::find(linksTo.begin(), linksTo.end(), this) != linksTo.end()) {
+        return false;
+    }
+#ifndef USE_OLD_DAG
+    std::lock_guard<std::mutex> lock(RecursiveListMutex);
+    _updateInListRecursive();
+    const auto& inLists = _inSetRecursive;
+#else
     auto inLists = getInListEx(true);
-    inLists.emplace(const_cast<DocumentObject*>(this));
+#endif
     for (auto obj : linksTo) {
         if (inLists.count(obj)) {
             return false;
@@ -836,6 +943,11 @@ void DocumentObject::onEarlyChange(const Property* prop)
 /// get called by the container when a Property was changed
 void DocumentObject::onChanged(const Property* prop)
 {
+    // keep the label index of the document up to date, even for frozen objects
+    if (prop == &Label && _pDoc && isAttachedToDocument()) {
+        _pDoc->onChangedLabel(this);
+    }
+
     if (isFreezed() && prop != &Visibility) {
         return;
     }
@@ -892,6 +1004,7 @@ void DocumentObject::clearOutListCache() const
     _outList.clear();
     _outListMap.clear();
     _outListCached = false;
+    clearRecursiveListCache();
 }
 
 PyObject* DocumentObject::getPyObject()
@@ -1254,6 +1367,7 @@ void App::DocumentObject::_removeBackLink(DocumentObject* rmvObj)
     auto it = std::find(_inList.begin(), _inList.end(), rmvObj);
     if (it != _inList.end()) {
         _inList.erase(it);
+        clearRecursiveListCache();
     }
 #else
     (void)rmvObj;
@@ -1268,6 +1382,7 @@ void App::DocumentObject::_addBackLink(DocumentObject* newObj)
     // only once this removal would clear the object from the inlist, even though there may be other
     // link properties from this object that link to us.
     _inList.push_back(newObj);
+    clearRecursiveListCache();
 #else
     (void)newObj;
 #endif  // USE_OLD_DAG
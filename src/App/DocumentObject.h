@@ -327,6 +327,13 @@ public:
     void _removeBackLink(DocumentObject*);
     /// internal, used by PropertyLink to maintain DAG back links
     void _addBackLink(DocumentObject*);
+    /** internal, invalidate the cached recursive in and out lists of all objects
+     *
+     * The results of getInListRecursive(), getInListEx(), getOutListRecursive() and
+     * the tests based on them are cached until the next change of any link. This is
+     * called automatically when links change or objects are added or removed.
+     */
+    static void clearRecursiveListCache();
     //@}
 
     /**
@@ -783,6 +790,16 @@ private:
     mutable std::unordered_map<const char*, App::DocumentObject*, CStringHasher, CStringHasher>
         _outListMap;
     mutable bool _outListCached = false;
+    // cached recursive in and out lists, valid as long as the version matches
+    // the one of the application wide link graph. They are released by
+    // clearRecursiveListCache() on any change of the graph.
+    mutable std::vector<App::DocumentObject*> _inListRecursive;
+    mutable std::set<App::DocumentObject*> _inSetRecursive;
+    mutable std::size_t _inListRecursiveVersion = 0;
+    mutable std::vector<App::DocumentObject*> _outListRecursive;
+    mutable std::size_t _outListRecursiveVersion = 0;
+
+    void _updateInListRecursive() const;
 };
 
 }  // namespace App
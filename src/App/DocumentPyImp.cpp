@@ -406,6 +406,39 @@ PyObject* DocumentPy::addObject(PyObject* args, PyObject* kwd)
     return pcFtr->getPyObject();
 }
 
+PyObject* DocumentPy::addObjects(PyObject* args)
+{
+    char* sType;
+    PyObject* names;
+    if (!PyArg_ParseTuple(args, "sO", &sType, &names)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        std::vector<std::string> objectNames;
+        Py::Sequence seq(names);
+        objectNames.reserve(seq.size());
+        for (Py::Sequence::iterator it = seq.begin(); it != seq.end(); ++it) {
+            objectNames.push_back(Py::String(*it).as_std_string("utf-8"));
+        }
+
+        std::vector<DocumentObject*> objs = getDocumentPtr()->addObjects(sType, objectNames);
+        if (objs.size() != objectNames.size()) {
+            std::stringstream str;
+            str << "No document object found of type '" << sType << "'" << std::ends;
+            throw Py::TypeError(str.str());
+        }
+
+        Py::List list;
+        for (auto obj : objs) {
+            list.append(Py::asObject(obj->getPyObject()));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH
+}
+
 PyObject* DocumentPy::removeObject(PyObject* args)
 {
     char* sName;
@@ -581,6 +614,51 @@ PyObject* DocumentPy::commitTransaction(PyObject* args)
     Py_Return;
 }
 
+PyObject* DocumentPy::beginBatchChanges(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->beginBatchChanges();
+    Py_Return;
+}
+
+PyObject* DocumentPy::endBatchChanges(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->endBatchChanges();
+    Py_Return;
+}
+
+PyObject* DocumentPy::batchChanges(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        // An ExitStack that ends the batch on exit serves as context manager
+        PyObject* module = PyImport_ImportModule("contextlib");
+        if (!module) {
+            return nullptr;
+        }
+        Py::Module contextlib(module, true);
+        Py::Callable exitStackType(contextlib.getAttr("ExitStack"));
+        Py::Object stack = exitStackType.apply(Py::Tuple());
+        Py::Callable callback(stack.getAttr("callback"));
+        Py::Tuple callbackArgs(1);
+        callbackArgs.setItem(0, Py::Object(this).getAttr("endBatchChanges"));
+        callback.apply(callbackArgs);
+
+        getDocumentPtr()->beginBatchChanges();
+        return Py::new_reference_to(stack);
+    }
+    PY_CATCH
+}
+
 Py::Boolean DocumentPy::getHasPendingTransaction() const
 {
     return {getDocumentPtr()->hasPendingTransaction()};
@@ -1,5 +1,6 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -73,6 +74,22 @@ ElementMap::ElementMap()
 }
 
 
+std::size_t ElementMap::MappedNameHash::operator()(const MappedName& name) const
+{
+    // FNV-1a over data and postfix as one continuous byte array, because two
+    // names are equal if their concatenation is equal
+    std::size_t hash = 14695981039346656037ULL;
+    auto combine = [&hash](const QByteArray& bytes) {
+        for (char c : bytes) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+    };
+    combine(name.dataBytes());
+    combine(name.postfixBytes());
+    return hash;
+}
+
 void ElementMap::beforeSave(const ::App::StringHasherRef& hasherRef) const
 {
     unsigned& id = _elementMapToId[this];
@@ -380,6 +397,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
         stream >> std::hex;
 
         indices.names.resize(outerCount);
+        this->mappedNames.reserve(this->mappedNames.size() + outerCount);
         for (int j = 0; j < outerCount; ++j) {
             idx.setIndex(j);
             auto* ref = &indices.names[j];
@@ -1072,8 +1090,16 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    // Iterate the names by element instead of the unordered mappedNames to
+    // keep the postfix table, and thus the saved file, stable
+    for (auto& indexedName : this->indexedNames) {
+        for (auto& name : indexedName.second.names) {
+            for (auto ref = &name; ref; ref = ref->next.get()) {
+                if (ref->name) {
+                    addPostfix(ref->name.postfixBytes(), postfixMap, postfixes);
+                }
+            }
+        }
     }
 
     childMaps.push_back(this);
@@ -1302,6 +1328,10 @@ std::vector<MappedElement> ElementMap::getAll() const
     for (auto& mappedName : this->mappedNames) {
         ret.emplace_back(mappedName.first, mappedName.second);
     }
+    // Keep the names sorted as before mappedNames became unordered
+    std::sort(ret.begin(), ret.end(), [](const MappedElement& a, const MappedElement& b) {
+        return a.name < b.name;
+    });
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
         IndexedName idx(child.indexedName);
@@ -37,6 +37,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <unordered_map>
 
 
 namespace Data
@@ -303,7 +304,18 @@ private:
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    /** Hash of a MappedName that is consistent with MappedName::operator==(),
+     * i.e. it only depends on the concatenation of data and postfix.
+     */
+    struct MappedNameHash
+    {
+        std::size_t operator()(const MappedName& name) const;
+    };
+
+    // Unordered for O(1) lookup. Names are compared by MappedName::compare()
+    // byte by byte, which makes an ordered map slow for large shapes. Use
+    // indexedNames for a deterministic iteration order.
+    std::unordered_map<MappedName, IndexedName, MappedNameHash> mappedNames;
 
     struct ChildMapInfo
     {
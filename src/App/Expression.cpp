@@ -502,6 +502,42 @@ static inline Quantity pyToQuantity(const Py::Object &pyobj,
     return q;
 }
 
+// Integers up to this magnitude are exact in a double
+static constexpr double MaxExactInteger = 9007199254740992.0;
+
+// Same conversion as pyFromQuantity() but without creating a Python object
+static void numericFromQuantity(const Quantity &quantity, NumericValue &value) {
+    value.quantity = quantity;
+    if(!quantity.getUnit().isEmpty()) {
+        value.type = NumericValue::Type::Quantity;
+        return;
+    }
+    long l;
+    int i;
+    switch(essentiallyInteger(quantity.getValue(),l,i)) {
+    case 1:
+    case 2:
+        value.type = NumericValue::Type::Integer;
+        value.quantity = Quantity(static_cast<double>(l));
+        break;
+    default:
+        value.type = NumericValue::Type::Float;
+        value.quantity = Quantity(quantity.getValue());
+    }
+}
+
+// Same conversion as pyObjectToAny(pyFromNumeric(value))
+static App::any anyFromNumeric(const NumericValue &value) {
+    switch(value.type) {
+    case NumericValue::Type::Integer:
+        return App::any(static_cast<long>(value.quantity.getValue()));
+    case NumericValue::Type::Float:
+        return App::any(value.quantity.getValue());
+    default:
+        return App::any(value.quantity);
+    }
+}
+
 Py::Object pyFromQuantity(const Quantity &quantity) {
     if(!quantity.getUnit().isEmpty())
         return Py::asObject(new QuantityPy(new Quantity(quantity)));
@@ -1107,10 +1143,19 @@ ExpressionPtr Expression::replaceObject(const DocumentObject *parent,
 }
 
 App::any Expression::getValueAsAny() const {
+    NumericValue value;
+    if(getNumericValue(value))
+        return anyFromNumeric(value);
     Base::PyGILStateLocker lock;
     return pyObjectToAny(getPyValue());
 }
 
+bool Expression::getNumericValue(NumericValue &value) const {
+    if(!components.empty())
+        return false;
+    return _getNumericValue(value);
+}
+
 Py::Object Expression::getPyValue() const {
     try {
         Py::Object pyobj = _getPyValue();
@@ -1138,6 +1183,9 @@ void Expression::visit(ExpressionVisitor &v) {
 }
 
 Expression* Expression::eval() const {
+    NumericValue value;
+    if(getNumericValue(value))
+        return new NumberExpression(owner,value.quantity);
     Base::PyGILStateLocker lock;
     return expressionFromPy(owner,getPyValue());
 }
@@ -1271,6 +1319,11 @@ Py::Object UnitExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool UnitExpression::_getNumericValue(NumericValue &value) const {
+    numericFromQuantity(quantity,value);
+    return true;
+}
+
 //
 // NumberExpression class
 //
@@ -1480,6 +1533,108 @@ Py::Object OperatorExpression::_getPyValue() const {
     return calc(this,op,left,right,false);
 }
 
+// Native counterpart of calc() for the arithmetic operators. Returns false
+// whenever Python would raise an error or the result could differ, so that the
+// caller falls back to calc().
+static bool calcNumeric(int op, const NumericValue &l, const NumericValue &r, NumericValue &res)
+{
+    if(l.type == NumericValue::Type::Quantity || r.type == NumericValue::Type::Quantity) {
+        res.type = NumericValue::Type::Quantity;
+        try {
+            switch(op) {
+            case OperatorExpression::ADD:
+                if(l.quantity.getUnit() != r.quantity.getUnit())
+                    return false;
+                res.quantity = l.quantity + r.quantity;
+                break;
+            case OperatorExpression::SUB:
+                if(l.quantity.getUnit() != r.quantity.getUnit())
+                    return false;
+                res.quantity = l.quantity - r.quantity;
+                break;
+            case OperatorExpression::MUL:
+            case OperatorExpression::UNIT:
+                res.quantity = l.quantity * r.quantity;
+                break;
+            case OperatorExpression::DIV:
+                res.quantity = l.quantity / r.quantity;
+                break;
+            default:
+                return false;
+            }
+        }
+        catch(Base::Exception &) {
+            return false;
+        }
+        return true;
+    }
+
+    double a = l.quantity.getValue();
+    double b = r.quantity.getValue();
+    double v;
+    switch(op) {
+    case OperatorExpression::ADD:
+        v = a + b;
+        break;
+    case OperatorExpression::SUB:
+        v = a - b;
+        break;
+    case OperatorExpression::MUL:
+    case OperatorExpression::UNIT:
+        v = a * b;
+        break;
+    case OperatorExpression::DIV:
+        // Python raises ZeroDivisionError
+        if(b == 0.0)
+            return false;
+        v = a / b;
+        break;
+    default:
+        return false;
+    }
+    if(op != OperatorExpression::DIV
+            && l.type == NumericValue::Type::Integer
+            && r.type == NumericValue::Type::Integer)
+    {
+        // Python integers do not overflow
+        if(std::fabs(v) > MaxExactInteger)
+            return false;
+        res.type = NumericValue::Type::Integer;
+    }
+    else
+        res.type = NumericValue::Type::Float;
+    res.quantity = Quantity(v);
+    return true;
+}
+
+bool OperatorExpression::_getNumericValue(NumericValue &value) const {
+    NumericValue l;
+    if(!left->getNumericValue(l))
+        return false;
+
+    switch(op) {
+    case POS:
+        value = l;
+        return true;
+    case NEG:
+        value.type = l.type;
+        if(l.type == NumericValue::Type::Quantity)
+            value.quantity = l.quantity * -1.0;
+        else if(l.type == NumericValue::Type::Integer)
+            value.quantity = Quantity(static_cast<double>(-static_cast<long>(l.quantity.getValue())));
+        else
+            value.quantity = Quantity(-l.quantity.getValue());
+        return true;
+    default:
+        break;
+    }
+
+    NumericValue r;
+    if(!right->getNumericValue(r))
+        return false;
+    return calcNumeric(op,l,r,value);
+}
+
 /**
   * Simplify the expression. For OperatorExpressions, we return a NumberExpression if
   * both the left and right side can be simplified to NumberExpressions. In this case
@@ -2925,6 +3080,33 @@ Py::Object VariableExpression::_getPyValue() const {
     return var.getPyValue(true);
 }
 
+bool VariableExpression::_getNumericValue(NumericValue &value) const {
+    auto prop = var.getDirectProperty();
+    if(!prop)
+        return false;
+
+    // Mirror the Python objects returned by the properties' getPyObject()
+    if(auto quantity = freecad_dynamic_cast<PropertyQuantity>(prop)) {
+        value.type = NumericValue::Type::Quantity;
+        value.quantity = Quantity(quantity->getValue(),quantity->getUnit());
+        return true;
+    }
+    if(auto number = freecad_dynamic_cast<PropertyFloat>(prop)) {
+        value.type = NumericValue::Type::Float;
+        value.quantity = Quantity(number->getValue());
+        return true;
+    }
+    if(auto integer = freecad_dynamic_cast<PropertyInteger>(prop)) {
+        auto l = integer->getValue();
+        if(std::fabs(static_cast<double>(l)) > MaxExactInteger)
+            return false;
+        value.type = NumericValue::Type::Integer;
+        value.quantity = Quantity(static_cast<double>(l));
+        return true;
+    }
+    return false;
+}
+
 void VariableExpression::_toString(std::ostream &ss, bool persistent,int) const {
     if(persistent)
         ss << var.toPersistentString();
@@ -3290,6 +3472,12 @@ Py::Object ConstantExpression::_getPyValue() const {
     return Py::Object(cache);
 }
 
+bool ConstantExpression::_getNumericValue(NumericValue &value) const {
+    if(!isNumber())
+        return false;
+    return NumberExpression::_getNumericValue(value);
+}
+
 bool ConstantExpression::isNumber() const {
     return strcmp(name,"None")
         && strcmp(name,"True")
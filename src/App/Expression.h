@@ -32,13 +32,9 @@
 #include <App/Range.h>
 #include <Base/Exception.h>
 #include <Base/BaseClass.h>
+#include <Base/Quantity.h>
 
 
-namespace Base
-{
-class Quantity;
-}
-
 namespace App  {
 
 class DocumentObject;
@@ -50,6 +46,22 @@ using ExpressionPtr = std::unique_ptr<Expression>;
 AppExport bool isAnyEqual(const App::any &v1, const App::any &v2);
 AppExport Base::Quantity anyToQuantity(const App::any &value, const char *errmsg = nullptr);
 
+/** Result of evaluating a numeric expression without Python
+ *
+ * The type mirrors the Python object (int, float or Quantity) that
+ * Expression::getPyValue() returns for the same expression, so that both ways
+ * of evaluation give identical results.
+ */
+struct NumericValue {
+    enum class Type {
+        Integer,
+        Float,
+        Quantity,
+    };
+    Type type = Type::Float;
+    Base::Quantity quantity;
+};
+
 // clang-format off
 // Map of depending objects to a map of depending property name to the full referencing object identifier
 using ExpressionDeps = std::map<App::DocumentObject*, std::map<std::string, std::vector<ObjectIdentifier> > >;
@@ -185,6 +197,15 @@ public:
 
     Py::Object getPyValue() const;
 
+    /** Evaluate the expression without going through Python
+     *
+     * Only numbers, units, arithmetic operators and references to integer,
+     * float or quantity properties are evaluated natively.
+     *
+     * @return false if the expression must be evaluated with getPyValue().
+     */
+    bool getNumericValue(NumericValue &value) const;
+
     bool isSame(const Expression &other, bool checkComment=true) const;
 
     friend class ExpressionVisitor;
@@ -211,6 +232,7 @@ protected:
     virtual void _moveCells(const CellAddress &, int, int, ExpressionVisitor &) {}
     virtual void _offsetCells(int, int, ExpressionVisitor &) {}
     virtual Py::Object _getPyValue() const = 0;
+    virtual bool _getNumericValue(NumericValue &) const {return false;}
     virtual void _visit(ExpressionVisitor &) {}
 
 protected:
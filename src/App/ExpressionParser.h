@@ -118,6 +118,7 @@ protected:
     Expression* _copy() const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue& value) const override;
 
 protected:
     mutable PyObject* cache = nullptr;
@@ -168,6 +169,7 @@ public:
 
 protected:
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue& value) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     Expression* _copy() const override;
 
@@ -237,6 +239,8 @@ protected:
 
     Py::Object _getPyValue() const override;
 
+    bool _getNumericValue(NumericValue& value) const override;
+
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
 
     void _visit(ExpressionVisitor& v) override;
@@ -421,6 +425,10 @@ protected:
                                              const Base::Matrix4D* transformationMatrix);
     static Py::Object translationMatrix(double x, double y, double z);
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue&) const override
+    {
+        return false;
+    }
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
@@ -471,6 +479,7 @@ public:
 protected:
     Expression* _copy() const override;
     Py::Object _getPyValue() const override;
+    bool _getNumericValue(NumericValue& value) const override;
     void _toString(std::ostream& ss, bool persistent, int indent) const override;
     bool _isIndexable() const override;
     void _getIdentifiers(std::map<App::ObjectIdentifier, bool>&) const override;
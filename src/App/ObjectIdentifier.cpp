@@ -1412,6 +1412,19 @@ Property* ObjectIdentifier::getProperty(int* ptype) const
     return result.resolvedProperty;
 }
 
+Property* ObjectIdentifier::getDirectProperty() const
+{
+    if (!subObjectName.getString().empty()) {
+        return nullptr;
+    }
+    ResolveResults result(*this);
+    if (result.propertyType != PseudoNone
+        || result.propertyIndex + 1 != static_cast<int>(components.size())) {
+        return nullptr;
+    }
+    return result.resolvedProperty;
+}
+
 Property* ObjectIdentifier::resolveProperty(const App::DocumentObject* obj,
                                             const char* propertyName,
                                             App::DocumentObject*& sobj,
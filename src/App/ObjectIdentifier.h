@@ -420,6 +420,13 @@ public:
 
     App::Property* getProperty(int* ptype = nullptr) const;
 
+    /** Return the property if its value is what the identifier refers to
+     *
+     * Returns nullptr if the identifier refers to a pseudo property, a sub-object
+     * or a member of the property, i.e. if getPyValue() is needed to get the value.
+     */
+    App::Property* getDirectProperty() const;
+
     App::ObjectIdentifier canonicalPath() const;
 
     // Document-centric functions
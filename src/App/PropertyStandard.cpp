@@ -1450,22 +1450,19 @@ void PropertyString::setValue(const char* newLabel)
         App::Document* doc = obj->getDocument();
         if (doc && !_hPGrp->GetBool("DuplicateLabels") && !obj->allowDuplicateLabel()) {
             std::vector<std::string> objectLabels;
-            std::vector<App::DocumentObject*>::const_iterator it;
-            std::vector<App::DocumentObject*> objs = doc->getObjects();
-            bool match = false;
-            for (it = objs.begin(); it != objs.end(); ++it) {
-                if (*it == obj) {
-                    continue;  // don't compare object with itself
-                }
-                std::string objLabel = (*it)->Label.getValue();
-                if (!match && objLabel == newLabel) {
-                    match = true;
-                }
-                objectLabels.push_back(objLabel);
-            }
+            // the object's own label differs from the new one, so a match is another object
+            bool match = doc->containsLabel(newLabel);
 
             // make sure that there is a name conflict otherwise we don't have to do anything
             if (match && *newLabel) {
+                // only collect the labels of the other objects if really needed
+                const std::vector<App::DocumentObject*>& objs = doc->getObjects();
+                objectLabels.reserve(objs.size());
+                for (auto it : objs) {
+                    if (it != obj) {
+                        objectLabels.push_back(it->Label.getStrValue());
+                    }
+                }
                 label = newLabel;
                 // remove number from end to avoid lengthy names
                 size_t lastpos = label.length() - 1;
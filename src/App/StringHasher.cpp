@@ -25,6 +25,8 @@
 #include <QCryptographicHash>
 #include <QHash>
 #include <deque>
+#include <mutex>
+#include <shared_mutex>
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -82,6 +84,10 @@ class StringHasher::HashMap: public HashMapBase
 public:
     bool SaveAll = false;
     int Threshold = 0;
+    /// Guards the table. Lookups take a shared lock, so that several threads
+    /// can query and add string IDs concurrently, e.g. when generating element
+    /// maps in parallel.
+    mutable std::shared_mutex Mutex;
 };
 
 ///////////////////////////////////////////////////////////
@@ -195,6 +201,8 @@ void StringHasher::compact()
         return;
     }
 
+    std::unique_lock<std::shared_mutex> lock(_hashes->Mutex);
+
     // Make a list of all the table entries that have only a single reference and are not marked
     // "persistent"
     std::deque<StringIDRef> pendings;
@@ -277,9 +285,12 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
         dataID._data = data;
     }
 
-    auto it = _hashes->left.find(&dataID);
-    if (it != _hashes->left.end()) {
-        return {it->first};
+    {
+        std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
+        auto it = _hashes->left.find(&dataID);
+        if (it != _hashes->left.end()) {
+            return {it->first};
+        }
     }
 
     if (!hashed && !nocopy) {
@@ -294,7 +305,8 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
     if (hashed) {
         flags.setFlag(StringID::Flag::Hashed);
     }
-    StringIDRef sid(new StringID(lastID() + 1, dataID._data, flags));
+    // The ID is assigned by insert()
+    StringIDRef sid(new StringID(0, dataID._data, flags));
     return {insert(sid)};
 }
 
@@ -321,13 +333,16 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // Check to see if there is already an entry in the hash table for this StringID
-    auto it = _hashes->left.find(&tempID);
-    if (it != _hashes->left.end()) {
-        auto res = StringIDRef(it->first);
-        if (indexed) {
-            res._index = indexed.getIndex();
+    {
+        std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
+        auto it = _hashes->left.find(&tempID);
+        if (it != _hashes->left.end()) {
+            auto res = StringIDRef(it->first);
+            if (indexed) {
+                res._index = indexed.getIndex();
+            }
+            return res;
         }
-        return res;
     }
 
     if (!indexed && name.isRaw()) {
@@ -348,8 +363,8 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         indexRef = getID(tempID._data);
     }
 
-    // The real StringID object that we are going to insert
-    StringIDRef newStringIDRef(new StringID(lastID() + 1, tempID._data));
+    // The real StringID object that we are going to insert. The ID is assigned by insert()
+    StringIDRef newStringIDRef(new StringID(0, tempID._data));
     StringID& newStringID = *newStringIDRef._sid;
     if (tempID._postfix.size() != 0) {
         newStringID._flags.setFlag(StringID::Flag::Postfixed);
@@ -437,6 +452,7 @@ StringIDRef StringHasher::getID(long id, int index) const
     if (id <= 0) {
         return {};
     }
+    std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
     auto it = _hashes->right.find(id);
     if (it == _hashes->right.end()) {
         return {};
@@ -505,6 +521,7 @@ void StringHasher::saveStream(std::ostream& stream) const
     long lastID = 0;
     bool relative = false;
 
+    std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
     for (auto& hasher : _hashes->right) {
         auto& d = *hasher.second;
         long id = d._id;
@@ -597,7 +614,10 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
     std::string ver;
     reader >> marker;
     std::size_t count = 0;
-    _hashes->clear();
+    {
+        std::unique_lock<std::shared_mutex> lock(_hashes->Mutex);
+        _hashes->clear();
+    }
     if (marker == "StringTableStart") {
         reader >> ver >> count;
         if (ver != "v1") {
@@ -613,7 +633,10 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
 void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
 {
     Base::TextInputStream asciiStream(stream);
-    _hashes->clear();
+    {
+        std::unique_lock<std::shared_mutex> lock(_hashes->Mutex);
+        _hashes->clear();
+    }
     std::string content;
     boost::io::ios_flags_saver ifs(stream);
     stream >> std::hex;
@@ -730,6 +753,16 @@ StringID* StringHasher::insert(const StringIDRef& sid)
 {
     assert(sid && sid._sid->_hasher == nullptr);
     auto& hasher = *sid._sid;
+    std::unique_lock<std::shared_mutex> lock(_hashes->Mutex);
+    if (hasher._id == 0) {
+        // Another thread may have added the same string since the caller
+        // looked it up
+        auto it = _hashes->left.find(&hasher);
+        if (it != _hashes->left.end()) {
+            return it->first;
+        }
+        hasher._id = lastID() + 1;
+    }
     hasher._hasher = this;
     hasher.ref();
     auto res = _hashes->right.insert(_hashes->right.end(),
@@ -743,7 +776,10 @@ StringID* StringHasher::insert(const StringIDRef& sid)
 
 void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 {
-    _hashes->clear();
+    {
+        std::unique_lock<std::shared_mutex> lock(_hashes->Mutex);
+        _hashes->clear();
+    }
     std::string content;
     for (uint32_t i = 0; i < count; ++i) {
         int32_t id = 0;
@@ -762,6 +798,7 @@ void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 
 void StringHasher::clear()
 {
+    std::unique_lock<std::shared_mutex> lock(_hashes->Mutex);
     for (auto& hasher : _hashes->right) {
         hasher.second->_hasher = nullptr;
         hasher.second->unref();
@@ -771,12 +808,14 @@ void StringHasher::clear()
 
 size_t StringHasher::size() const
 {
+    std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
     return _hashes->size();
 }
 
 size_t StringHasher::count() const
 {
     size_t count = 0;
+    std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
     for (auto& hasher : _hashes->right) {
         if (hasher.second->isMarked() || hasher.second->isPersistent()) {
             ++count;
@@ -854,6 +893,7 @@ PyObject* StringHasher::getPyObject()
 std::map<long, StringIDRef> StringHasher::getIDMap() const
 {
     std::map<long, StringIDRef> ret;
+    std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
     for (auto& hasher : _hashes->right) {
         ret.emplace_hint(ret.end(), hasher.first, StringIDRef(hasher.second));
     }
@@ -862,6 +902,7 @@ std::map<long, StringIDRef> StringHasher::getIDMap() const
 
 void StringHasher::clearMarks() const
 {
+    std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
     for (auto& hasher : _hashes->right) {
         hasher.second->_flags.setFlag(StringID::Flag::Marked, false);
     }
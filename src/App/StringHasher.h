@@ -630,6 +630,9 @@ private:
 /// If the string is longer than a given threshold, instead of storing the string, its SHA1 hash is
 /// stored (and the original string discarded). This allows an upper threshold on the length of a
 /// stored string, while still effectively guaranteeing uniqueness in the table.
+///
+/// Adding and looking up strings is thread-safe. Saving, restoring and compacting the table must
+/// not run concurrently with other operations on the same hasher.
 class AppExport StringHasher: public Base::Persistence, public Base::Handled
 {
 
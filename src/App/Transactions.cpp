@@ -116,7 +116,19 @@ int Transaction::getLastID()
 
 unsigned int Transaction::getMemSize() const
 {
-    return 0;
+    if (memSize == 0) {
+        unsigned int size = sizeof(Transaction);
+        for (const auto& It : _Objects.get<0>()) {
+            size += sizeof(Info) + It.second->getMemSize();
+            // An object removed from the document is owned by the transaction
+            if (It.second->status == TransactionObject::New
+                && !It.first->isAttachedToDocument()) {
+                size += It.first->getMemSize();
+            }
+        }
+        memSize = size;
+    }
+    return memSize;
 }
 
 void Transaction::Save(Base::Writer& /*writer*/) const
@@ -146,6 +158,7 @@ bool Transaction::hasObject(const TransactionalObject* Obj) const
 
 void Transaction::addOrRemoveProperty(TransactionalObject* Obj, const Property* pcProp, bool add)
 {
+    memSize = 0;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -199,6 +212,7 @@ void Transaction::apply(Document& Doc, bool forward)
 
 void Transaction::addObjectNew(TransactionalObject* Obj)
 {
+    memSize = 0;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
     if (pos != index.end()) {
@@ -228,6 +242,7 @@ void Transaction::addObjectNew(TransactionalObject* Obj)
 
 void Transaction::addObjectDel(const TransactionalObject* Obj)
 {
+    memSize = 0;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -249,6 +264,7 @@ void Transaction::addObjectDel(const TransactionalObject* Obj)
 
 void Transaction::addObjectChange(const TransactionalObject* Obj, const Property* Prop)
 {
+    memSize = 0;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -424,7 +440,14 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
 
 unsigned int TransactionObject::getMemSize() const
 {
-    return 0;
+    unsigned int size = sizeof(TransactionObject) + _NameInDocument.size();
+    for (const auto& v : _PropChangeMap) {
+        size += sizeof(v) + v.second.name.size();
+        if (v.second.property) {
+            size += v.second.property->getMemSize();
+        }
+    }
+    return size;
 }
 
 void TransactionObject::Save(Base::Writer& /*writer*/) const
@@ -65,6 +65,7 @@ public:
     // the utf-8 name of the transaction
     std::string Name;
 
+    /// Estimated memory held by the recorded property copies and removed objects
     unsigned int getMemSize() const override;
     void Save(Base::Writer& writer) const override;
     /// This method is used to restore properties from an XML document.
@@ -89,6 +90,8 @@ public:
 
 private:
     int transID;
+    // cached result of getMemSize(), reset whenever the transaction is modified
+    mutable unsigned int memSize {0};
     using Info = std::pair<const TransactionalObject*, TransactionObject*>;
     bmi::multi_index_container<
         Info,
@@ -33,6 +33,7 @@
 #include <CXX/Objects.hxx>
 #include <boost/bimap.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -66,8 +67,28 @@ struct DocumentP
     std::unordered_set<App::DocumentObject*> touchedObjs;
     std::unordered_map<std::string, DocumentObject*> objectMap;
     std::unordered_map<long, DocumentObject*> objectIdMap;
+    // numeric suffixes of all object names grouped by the name without its
+    // trailing digits, so that finding a unique name doesn't scan objectMap
+    struct SuffixLess
+    {
+        bool operator()(const std::string& s1, const std::string& s2) const
+        {
+            return s1.size() != s2.size() ? s1.size() < s2.size() : s1 < s2;
+        }
+    };
+    std::unordered_map<std::string, std::set<std::string, SuffixLess>> objectNameSuffixes;
+    // number of objects per label, so that the duplicate label check doesn't compare
+    // the labels of all objects. The label each object is counted with is kept
+    // because the old label is not always known when the label has changed.
+    std::unordered_map<std::string, int> objectLabels;
+    std::unordered_map<const DocumentObject*, std::string> countedLabels;
     std::unordered_map<std::string, bool> partialLoadObjects;
     std::vector<DocumentObjectT> pendingRemove;
+    // change notifications deferred by Document::beginBatchChanges(), the
+    // objects are kept by ID and the properties by name in the order of change
+    int batchChanges {0};
+    std::vector<std::pair<long, std::vector<std::string>>> batchedChanges;
+    std::unordered_map<long, std::size_t> batchedChangeIndex;
     long lastObjectId;
     DocumentObject* activeObject;
     Transaction* activeUndoTransaction;
@@ -136,7 +157,99 @@ struct DocumentP
             v.second = nullptr;
         }
         objectMap.clear();
+        objectNameSuffixes.clear();
+        objectLabels.clear();
+        countedLabels.clear();
         objectIdMap.clear();
+        DocumentObject::clearRecursiveListCache();
+    }
+
+    static std::pair<std::string, std::string> splitNameSuffix(const std::string& name)
+    {
+        std::string::size_type pos = name.find_last_not_of("0123456789");
+        if (pos == std::string::npos) {
+            return {name, std::string()};
+        }
+        return {name.substr(0, pos + 1), name.substr(pos + 1)};
+    }
+
+    /// Insert the object into the name map and keep track of its numeric suffix
+    const std::string* addObjectName(const std::string& name, DocumentObject* obj)
+    {
+        auto res = objectMap.insert_or_assign(name, obj);
+        DocumentObject::clearRecursiveListCache();
+        updateObjectLabel(obj);
+        auto [base, suffix] = splitNameSuffix(name);
+        if (!suffix.empty()) {
+            objectNameSuffixes[base].insert(suffix);
+        }
+        return &res.first->first;
+    }
+
+    void removeObjectName(std::unordered_map<std::string, DocumentObject*>::iterator pos)
+    {
+        auto [base, suffix] = splitNameSuffix(pos->first);
+        removeObjectLabel(pos->second);
+        objectMap.erase(pos);
+        DocumentObject::clearRecursiveListCache();
+        if (suffix.empty()) {
+            return;
+        }
+        auto it = objectNameSuffixes.find(base);
+        if (it != objectNameSuffixes.end()) {
+            it->second.erase(suffix);
+            if (it->second.empty()) {
+                objectNameSuffixes.erase(it);
+            }
+        }
+    }
+
+    /// Count the object with its current label
+    void updateObjectLabel(const DocumentObject* obj)
+    {
+        const std::string& label = obj->Label.getStrValue();
+        auto res = countedLabels.emplace(obj, label);
+        if (!res.second) {
+            if (res.first->second == label) {
+                return;
+            }
+            uncountLabel(res.first->second);
+            res.first->second = label;
+        }
+        ++objectLabels[label];
+    }
+
+    void removeObjectLabel(const DocumentObject* obj)
+    {
+        auto it = countedLabels.find(obj);
+        if (it != countedLabels.end()) {
+            uncountLabel(it->second);
+            countedLabels.erase(it);
+        }
+    }
+
+    void uncountLabel(const std::string& label)
+    {
+        auto it = objectLabels.find(label);
+        if (it != objectLabels.end() && --it->second <= 0) {
+            objectLabels.erase(it);
+        }
+    }
+
+    /*!
+     * Returns the names that Base::Tools::getUniqueName() has to consider to
+     * make \a name unique. Of all object names with the same base name only the
+     * one with the highest numeric suffix can affect the result. \a name itself
+     * is added so that the list is never empty.
+     */
+    std::vector<std::string> getUniqueNameCandidates(const std::string& name) const
+    {
+        std::vector<std::string> names {name};
+        auto it = objectNameSuffixes.find(splitNameSuffix(name).first);
+        if (it != objectNameSuffixes.end()) {
+            names.push_back(it->first + *it->second.rbegin());
+        }
+        return names;
     }
 
     const char* findRecomputeLog(const App::DocumentObject* obj)
@@ -28,7 +28,9 @@
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #endif
 
+#include <algorithm>
 #include <locale>
+#include <thread>
 
 #include "Reader.h"
 #include "Base64.h"
@@ -55,6 +57,39 @@ XERCES_CPP_NAMESPACE_USE
 
 using namespace std;
 
+namespace
+{
+// Element and attribute names and most attribute values are plain ASCII, so the
+// characters are copied directly into the reused buffer and the transcoder is only
+// used for the remaining strings.
+template<typename Transcode>
+void transcodeTo(const XMLCh* const str, std::string& out, Transcode transcode)
+{
+    out.clear();
+    for (const XMLCh* it = str; *it; ++it) {
+        if (*it >= 0x80) {
+            out = transcode(str);
+            return;
+        }
+        out.push_back(static_cast<char>(*it));
+    }
+}
+
+void transcodeName(const XMLCh* const name, std::string& out)
+{
+    transcodeTo(name, out, [](const XMLCh* const str) {
+        return std::string(StrX(str).c_str());
+    });
+}
+
+void transcodeValue(const XMLCh* const value, std::string& out)
+{
+    transcodeTo(value, out, [](const XMLCh* const str) {
+        return XMLTools::toStdString(str);
+    });
+}
+}  // namespace
+
 
 // ---------------------------------------------------------------------------
 //  Base::XMLReader: Constructors and Destructor
@@ -110,7 +145,17 @@ const char* Base::XMLReader::localName() const
 
 unsigned int Base::XMLReader::getAttributeCount() const
 {
-    return static_cast<unsigned int>(AttrMap.size());
+    return static_cast<unsigned int>(AttrCount);
+}
+
+const Base::XMLReader::Attribute* Base::XMLReader::findAttribute(const char* AttrName) const
+{
+    for (std::size_t i = 0; i < AttrCount; i++) {
+        if (AttrList[i].name == AttrName) {
+            return &AttrList[i];
+        }
+    }
+    return nullptr;
 }
 
 long Base::XMLReader::getAttributeAsInteger(const char* AttrName, const char* defaultValue) const
@@ -132,10 +177,8 @@ double Base::XMLReader::getAttributeAsFloat(const char* AttrName, const char* de
 const char* Base::XMLReader::getAttribute(const char* AttrName,            // NOLINT
                                           const char* defaultValue) const  // NOLINT
 {
-    auto pos = AttrMap.find(AttrName);
-
-    if (pos != AttrMap.end()) {
-        return pos->second.c_str();
+    if (const Attribute* attr = findAttribute(AttrName)) {
+        return attr->value.c_str();
     }
     if (defaultValue) {
         return defaultValue;
@@ -148,7 +191,7 @@ const char* Base::XMLReader::getAttribute(const char* AttrName,            // NO
 
 bool Base::XMLReader::hasAttribute(const char* AttrName) const
 {
-    return AttrMap.find(AttrName) != AttrMap.end();
+    return findAttribute(AttrName) != nullptr;
 }
 
 bool Base::XMLReader::read()
@@ -410,6 +453,7 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // project file was created without GUI
         return;
     }
+    DecodeTaskQueue decodeQueue;
     std::vector<FileEntry>::const_iterator it = FileList.begin();
     Base::SequencerLauncher seq("Importing project files...", FileList.size());
     while (entry->isValid() && it != FileList.end()) {
@@ -423,7 +467,10 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // no file name for the current entry in the zip was registered.
         if (jt != FileList.end()) {
             try {
-                Base::Reader reader(zipstream, jt->FileName, FileVersion);
+                Base::Reader reader(zipstream,
+                                    jt->FileName,
+                                    FileVersion,
+                                    ParallelDecode ? &decodeQueue : nullptr);
                 jt->Object->RestoreDocFile(reader);
                 if (reader.getLocalReader()) {
                     reader.getLocalReader()->readFiles(zipstream);
@@ -454,6 +501,18 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
             break;
         }
     }
+
+    decodeQueue.applyAll();
+}
+
+void Base::XMLReader::setParallelDecode(bool on)
+{
+    ParallelDecode = on;
+}
+
+bool Base::XMLReader::isParallelDecode() const
+{
+    return ParallelDecode;
 }
 
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
@@ -524,12 +583,17 @@ void Base::XMLReader::startElement(const XMLCh* const /*uri*/,
                                    const XERCES_CPP_NAMESPACE_QUALIFIER Attributes& attrs)
 {
     Level++;  // new scope
-    LocalName = StrX(localname).c_str();
+    transcodeName(localname, LocalName);
 
-    // saving attributes of the current scope, delete all previously stored ones
-    AttrMap.clear();
-    for (unsigned int i = 0; i < attrs.getLength(); i++) {
-        AttrMap[StrX(attrs.getQName(i)).c_str()] = StrXUTF8(attrs.getValue(i)).c_str();
+    // saving attributes of the current scope, overwrite all previously stored ones
+    AttrCount = attrs.getLength();
+    if (AttrList.size() < AttrCount) {
+        AttrList.resize(AttrCount);
+    }
+    for (std::size_t i = 0; i < AttrCount; i++) {
+        auto index = static_cast<XMLSize_t>(i);
+        transcodeName(attrs.getQName(index), AttrList[i].name);
+        transcodeValue(attrs.getValue(index), AttrList[i].value);
     }
 
     ReadType = StartElement;
@@ -540,7 +604,7 @@ void Base::XMLReader::endElement(const XMLCh* const /*uri*/,
                                  const XMLCh* const /*qname*/)
 {
     Level--;  // end of scope
-    LocalName = StrX(localname).c_str();
+    transcodeName(localname, LocalName);
 
     if (ReadType == StartElement) {
         ReadType = StartEndElement;
@@ -653,11 +717,15 @@ void Base::XMLReader::clearPartialRestoreObject()
 // ----------------------------------------------------------
 
 // NOLINTNEXTLINE
-Base::Reader::Reader(std::istream& str, const std::string& name, int version)
+Base::Reader::Reader(std::istream& str,
+                     const std::string& name,
+                     int version,
+                     DecodeTaskQueue* queue)
     : std::istream(str.rdbuf())
     , _str(str)
     , _name(name)
     , fileVersion(version)
+    , decodeQueue(queue)
 {}
 
 std::string Base::Reader::getFileName() const
@@ -684,3 +752,68 @@ std::shared_ptr<Base::XMLReader> Base::Reader::getLocalReader() const
 {
     return (this->localreader);
 }
+
+bool Base::Reader::canDecodeInParallel() const
+{
+    return decodeQueue != nullptr;
+}
+
+void Base::Reader::addDecodeTask(std::function<void()> decode, std::function<void()> apply)
+{
+    if (!decodeQueue) {
+        decode();
+        apply();
+        return;
+    }
+    decodeQueue->add(std::move(decode), std::move(apply));
+}
+
+void Base::Reader::applyDecodeTasks()
+{
+    if (decodeQueue) {
+        decodeQueue->applyAll();
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+Base::DecodeTaskQueue::~DecodeTaskQueue()
+{
+    // Only wait for the workers, applying the results is up to the owner
+    for (auto& task : tasks) {
+        task.decode.wait();
+    }
+}
+
+void Base::DecodeTaskQueue::add(std::function<void()> decode, std::function<void()> apply)
+{
+    // Limit the number of running workers
+    const std::size_t maxPending = std::max(2U, std::thread::hardware_concurrency());
+    while (tasks.size() >= maxPending) {
+        applyNext();
+    }
+    tasks.push_back({std::async(std::launch::async, std::move(decode)), std::move(apply)});
+}
+
+void Base::DecodeTaskQueue::applyAll()
+{
+    while (!tasks.empty()) {
+        applyNext();
+    }
+}
+
+void Base::DecodeTaskQueue::applyNext()
+{
+    Task task = std::move(tasks.front());
+    tasks.pop_front();
+    try {
+        task.decode.get();
+        task.apply();
+    }
+    catch (const std::exception& e) {
+        Base::Console().Error("Decoding embedded file failed: %s\n", e.what());
+    }
+    catch (...) {
+        Base::Console().Error("Decoding embedded file failed\n");
+    }
+}
@@ -24,10 +24,14 @@
 #define BASE_READER_H
 
 #include <bitset>
+#include <deque>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <xercesc/framework/XMLPScanToken.hpp>
 #include <xercesc/sax2/Attributes.hpp>
@@ -251,6 +255,9 @@ public:
     const char* addFile(const char* Name, Base::Persistence* Object);
     /// process the requested file writes
     void readFiles(zipios::ZipInputStream& zipstream) const;
+    /// allow objects to decode their files in parallel, see Reader::addDecodeTask()
+    void setParallelDecode(bool on);
+    bool isParallelDecode() const;
     /// get all registered file names
     const std::vector<std::string>& getFilenames() const;
     /// returns true if reading the file \a filename has failed
@@ -332,8 +339,19 @@ private:
     unsigned int CharacterCount {0};
     std::streamsize CharacterOffset {-1};
 
-    std::map<std::string, std::string> AttrMap;
-    using AttrMapType = std::map<std::string, std::string>;
+    // The attributes of the current element. The list is not shrunk when the next
+    // element is read so that the string buffers are reused, only the first
+    // AttrCount entries are valid. Elements have few attributes, so a linear search
+    // is faster than a map that is rebuilt for every element.
+    struct Attribute
+    {
+        std::string name;
+        std::string value;
+    };
+    std::vector<Attribute> AttrList;
+    std::size_t AttrCount {0};
+
+    const Attribute* findAttribute(const char* AttrName) const;
 
     enum
     {
@@ -366,27 +384,78 @@ public:
 private:
     std::vector<std::string> FileNames;
     mutable std::vector<std::string> FailedFiles;
+    bool ParallelDecode {false};
 
     std::bitset<32> StatusBits;
 
     std::unique_ptr<std::istream> CharStream;
 };
 
+/** The DecodeTaskQueue class
+ * Runs the decoding of document files on worker threads and applies the
+ * results in the order the tasks were added.
+ */
+class BaseExport DecodeTaskQueue
+{
+public:
+    DecodeTaskQueue() = default;
+    ~DecodeTaskQueue();
+
+    void add(std::function<void()> decode, std::function<void()> apply);
+    /// wait for all pending tasks and apply their results
+    void applyAll();
+
+    DecodeTaskQueue(const DecodeTaskQueue&) = delete;
+    DecodeTaskQueue(DecodeTaskQueue&&) = delete;
+    DecodeTaskQueue& operator=(const DecodeTaskQueue&) = delete;
+    DecodeTaskQueue& operator=(DecodeTaskQueue&&) = delete;
+
+private:
+    void applyNext();
+
+private:
+    struct Task
+    {
+        std::future<void> decode;
+        std::function<void()> apply;
+    };
+    std::deque<Task> tasks;
+};
+
 class BaseExport Reader: public std::istream
 {
 public:
-    Reader(std::istream&, const std::string&, int version);
+    Reader(std::istream&, const std::string&, int version, DecodeTaskQueue* queue = nullptr);
     std::istream& getStream();
     std::string getFileName() const;
     int getFileVersion() const;
     void initLocalReader(std::shared_ptr<Base::XMLReader>);
     std::shared_ptr<Base::XMLReader> getLocalReader() const;
 
+    /** @name Parallel decoding */
+    //@{
+    /// returns true if addDecodeTask() can be used
+    bool canDecodeInParallel() const;
+    /** Defer the decoding of the file content
+     * An object that has read the raw content of its file in RestoreDocFile() can
+     * pass the costly decoding as \a decode, which then runs on a worker thread and
+     * must not access any shared data. \a apply is called afterwards in the main
+     * thread, in the order the tasks were added, to assign the result.
+     */
+    void addDecodeTask(std::function<void()> decode, std::function<void()> apply);
+    /** Apply all pending decode tasks
+     * To be called by objects whose restore depends on the data of the files
+     * restored before them.
+     */
+    void applyDecodeTasks();
+    //@}
+
 private:
     std::istream& _str;
     std::string _name;
     int fileVersion;
     std::shared_ptr<Base::XMLReader> localreader;
+    DecodeTaskQueue* decodeQueue;
 };
 
 }  // namespace Base
@@ -23,9 +23,13 @@
 
 #include "PreCompiled.h"
 
+#include <deque>
+#include <future>
 #include <limits>
 #include <locale>
 #include <iomanip>
+#include <thread>
+#include <zlib.h>
 
 #include "Writer.h"
 #include "Base64.h"
@@ -360,6 +364,11 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
 
 void ZipWriter::writeFiles()
 {
+    if (Parallel) {
+        writeFilesParallel();
+        return;
+    }
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
@@ -373,6 +382,110 @@ void ZipWriter::writeFiles()
     }
 }
 
+namespace
+{
+struct CompressedEntry
+{
+    zipios::ZipCDirEntry entry;
+    std::string data;
+};
+
+bool isCompressedFile(const std::string& name)
+{
+    std::string ext = FileInfo(name).extension();
+    for (const char* compressed : {"png", "jpg", "jpeg", "gz", "bz2", "xz", "zip", "7z"}) {
+        if (ext == compressed) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Deflate the data the same way zipios::ZipOutputStream does, i.e. without zlib
+// header. If this doesn't reduce the size the data is stored instead.
+CompressedEntry compressEntry(const std::string& name, const std::string& data, int level)
+{
+    CompressedEntry res {zipios::ZipCDirEntry(name), {}};
+    auto size = static_cast<uLong>(data.size());
+    auto input = reinterpret_cast<const Bytef*>(data.data());  // NOLINT
+    res.entry.setSize(size);
+    res.entry.setCrc(crc32(crc32(0, Z_NULL, 0), input, size));
+
+    if (level != Z_NO_COMPRESSION) {
+        z_stream zs {};
+        if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK) {
+            res.data.resize(deflateBound(&zs, size));
+            zs.next_in = const_cast<Bytef*>(input);  // NOLINT
+            zs.avail_in = size;
+            zs.next_out = reinterpret_cast<Bytef*>(&res.data[0]);  // NOLINT
+            zs.avail_out = static_cast<uInt>(res.data.size());
+            int err = deflate(&zs, Z_FINISH);
+            deflateEnd(&zs);
+            if (err == Z_STREAM_END && zs.total_out < size) {
+                res.data.resize(zs.total_out);
+                res.entry.setMethod(zipios::DEFLATED);
+                res.entry.setCompressedSize(static_cast<zipios::uint32>(res.data.size()));
+                return res;
+            }
+        }
+    }
+
+    res.data = data;
+    res.entry.setMethod(zipios::STORED);
+    res.entry.setCompressedSize(size);
+    return res;
+}
+}  // namespace
+
+void ZipWriter::writeFilesParallel()
+{
+    // Limit the number of buffered files to bound the memory usage
+    const std::size_t maxPending = std::max(2U, std::thread::hardware_concurrency());
+    std::deque<std::future<CompressedEntry>> pending;
+    auto writeNext = [this, &pending]() {
+        CompressedEntry res = pending.front().get();
+        pending.pop_front();
+        ZipStream.putRawEntry(res.entry, res.data.c_str());
+    };
+
+    size_t index = 0;
+    while (index < FileList.size()) {
+        FileEntry entry = FileList[index];
+        Writer::putNextEntry(entry.FileName.c_str());
+        indent = 0;
+        indBuf[0] = 0;
+
+        std::ostringstream buffer;
+        buffer.imbue(ZipStream.getloc());
+        buffer.precision(ZipStream.precision());
+        buffer.flags(ZipStream.flags());
+        EntryStream = &buffer;
+        try {
+            entry.Object->SaveDocFile(*this);
+        }
+        catch (...) {
+            EntryStream = nullptr;
+            throw;
+        }
+        EntryStream = nullptr;
+
+        int level = isCompressedFile(entry.FileName) ? Z_NO_COMPRESSION : Level;
+        pending.push_back(std::async(std::launch::async,
+                                     compressEntry,
+                                     entry.FileName,
+                                     buffer.str(),
+                                     level));
+        while (pending.size() >= maxPending) {
+            writeNext();
+        }
+        index++;
+    }
+
+    while (!pending.empty()) {
+        writeNext();
+    }
+}
+
 ZipWriter::~ZipWriter()
 {
     ZipStream.close();
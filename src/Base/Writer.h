@@ -198,7 +198,7 @@ public:
 
     std::ostream& Stream() override
     {
-        return ZipStream;
+        return EntryStream ? *EntryStream : ZipStream;
     }
 
     void setComment(const char* str)
@@ -207,8 +207,23 @@ public:
     }
     void setLevel(int level)
     {
+        Level = level;
         ZipStream.setLevel(level);
     }
+    /** Compress the additional files in parallel
+     * If enabled, writeFiles() still serialises the files one by one in the
+     * calling thread, but buffers each file and deflates it on a worker thread.
+     * The files are added to the archive in the same order as before. Files
+     * that are already compressed, like images, are stored as they are.
+     */
+    void setParallel(bool on)
+    {
+        Parallel = on;
+    }
+    bool isParallel() const
+    {
+        return Parallel;
+    }
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
     ZipWriter(const ZipWriter&) = delete;
@@ -216,8 +231,14 @@ public:
     ZipWriter& operator=(const ZipWriter&) = delete;
     ZipWriter& operator=(ZipWriter&&) = delete;
 
+private:
+    void writeFilesParallel();
+
 private:
     zipios::ZipOutputStream ZipStream;
+    std::ostream* EntryStream {nullptr};
+    int Level {6};
+    bool Parallel {false};
 };
 
 /** The StringWriter class
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
 # include <cctype>
 # include <mutex>
 # include <QApplication>
@@ -507,6 +508,9 @@ Document::Document(App::Document* pcDocument,Application * app)
         d->_pcDocument->setUndoMode(1);
         // set the maximum stack size
         d->_pcDocument->setMaxUndoStackSize(hGrp->GetInt("MaxUndoSize",20));
+        // set the maximum memory of the stack in MB, 0 means no limit
+        unsigned long undoMemory = std::min<unsigned long>(hGrp->GetUnsigned("MaxUndoMemory", 0), 4095);
+        d->_pcDocument->setUndoLimit(static_cast<unsigned int>(undoMemory * 1024 * 1024));
     }
 
     d->_changeViewTouchDocument = hGrp->GetBool("ChangeViewProviderTouchDocument", true);
@@ -1637,6 +1641,9 @@ void Document::Restore(Base::XMLReader &reader)
  */
 void Document::RestoreDocFile(Base::Reader &reader)
 {
+    // The view providers expect the data of the document objects to be complete
+    reader.applyDecodeTasks();
+
     // We must create an XML parser to read from the input stream
     std::shared_ptr<Base::XMLReader> localreader = std::make_shared<Base::XMLReader>("GuiDocument.xml", reader);
     localreader->FileVersion = reader.getFileVersion();
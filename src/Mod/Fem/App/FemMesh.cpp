@@ -24,14 +24,22 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
+#include <array>
 #include <cstdlib>
 #include <memory>
 
+#include <BRepAdaptor_Curve.hxx>
 #include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
+#include <GCPnts_QuasiUniformDeflection.hxx>
+#include <Poly_Triangulation.hxx>
 #include <SMDS_MeshGroup.hxx>
 #include <SMESHDS_Group.hxx>
 #include <SMESHDS_GroupBase.hxx>
@@ -50,6 +58,9 @@
 #include <StdMeshers_Quadrangle_2D.hxx>
 #include <StdMeshers_Regular_1D.hxx>
 #include <StdMeshers_StartEndLength.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Solid.hxx>
@@ -60,6 +71,9 @@
 #include <boost/tokenizer.hpp>  //to simplify parsing input files we use the boost lib
 #endif
 
+#include <boost_geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
 #include <App/Application.h>
 #include <Base/Console.h>
 #include <Base/Exception.h>
@@ -69,6 +83,7 @@
 #include <Base/TimeInfo.h>
 #include <Base/Writer.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Part/App/Tools.h>
 
 #include "FemMesh.h"
 #include <FemMeshPy.h>
@@ -137,6 +152,7 @@ FemMesh& FemMesh::operator=(const FemMesh& mesh)
 
 void FemMesh::copyMeshData(const FemMesh& mesh)
 {
+    invalidateNodeIndex();
     _Mtrx = mesh._Mtrx;
 
     // 1. Get source mesh
@@ -269,6 +285,8 @@ const SMESH_Mesh* FemMesh::getSMesh() const
 
 SMESH_Mesh* FemMesh::getSMesh()
 {
+    // the caller may modify the nodes
+    invalidateNodeIndex();
     return myMesh;
 }
 
@@ -328,6 +346,7 @@ void FemMesh::setStandardHypotheses()
 
 void FemMesh::compute()
 {
+    invalidateNodeIndex();
     getGenerator()->Compute(*myMesh, myMesh->GetShapeToMesh());
 }
 
@@ -337,69 +356,299 @@ std::set<long> FemMesh::getSurfaceNodes(long /*ElemId*/, short /*FaceId*/, float
     return result;
 }
 
-/*! That function returns map containing volume ID and face ID.
+namespace
+{
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+using Point3d = bg::model::point<double, 3, bg::cs::cartesian>;
+using Box3d = bg::model::box<Point3d>;
+using NodeList = std::vector<std::pair<int, gp_Pnt>>;
+
+Box3d makeBox(const gp_Pnt& pnt, double dist)
+{
+    return {Point3d(pnt.X() - dist, pnt.Y() - dist, pnt.Z() - dist),
+            Point3d(pnt.X() + dist, pnt.Y() + dist, pnt.Z() + dist)};
+}
+
+double distanceToSegment(const gp_Pnt& pnt, const gp_Pnt& p1, const gp_Pnt& p2)
+{
+    gp_Vec dir(p1, p2);
+    double len2 = dir.SquareMagnitude();
+    if (len2 <= 0.0) {
+        return pnt.Distance(p1);
+    }
+    double param = std::clamp(gp_Vec(p1, pnt).Dot(dir) / len2, 0.0, 1.0);
+    return pnt.Distance(p1.Translated(param * dir));
+}
+
+double distanceToTriangle(const gp_Pnt& pnt, const gp_Pnt& p1, const gp_Pnt& p2, const gp_Pnt& p3)
+{
+    gp_Vec u(p1, p2);
+    gp_Vec v(p1, p3);
+    gp_Vec normal = u.Crossed(v);
+    double area2 = normal.SquareMagnitude();
+    if (area2 > 0.0) {
+        // barycentric coordinates of the projection onto the plane of the triangle
+        gp_Vec w(p1, pnt);
+        double s = w.Crossed(v).Dot(normal) / area2;
+        double t = u.Crossed(w).Dot(normal) / area2;
+        if (s >= 0.0 && t >= 0.0 && s + t <= 1.0) {
+            return std::abs(w.Dot(normal)) / std::sqrt(area2);
+        }
+    }
+
+    return std::min({distanceToSegment(pnt, p1, p2),
+                     distanceToSegment(pnt, p2, p3),
+                     distanceToSegment(pnt, p3, p1)});
+}
+
+/*!
+ * Approximation of a face, solid or edge by triangles (or segments) to
+ * quickly reject nodes that are too far away before the exact distance
+ * is computed.
  */
-std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face) const
+class BoundaryIndex
 {
-    std::list<std::pair<int, int>> result;
-    std::set<int> nodes_on_face = getNodesByFace(face);
+public:
+    /// Use the triangulation of all faces, a copy of the shape is meshed if needed
+    bool addFaces(const TopoDS_Shape& shape);
+    /// Use a polygon of the edge
+    bool addEdge(const TopoDS_Edge& edge);
+    /// Check if the point is at most the given distance away from the approximation
+    bool isNear(const gp_Pnt& pnt, double dist) const;
+    /// Deviation of the approximation from the real geometry
+    double getDeflection() const
+    {
+        return deflection;
+    }
 
-    // SMDS_MeshVolume::facesIterator() is broken with SMESH7 as it is impossible
-    // to iterate volume faces
-    // In SMESH9 this function has been removed
-    //
-    std::map<int, std::set<int>> face_nodes;
+private:
+    bool addTriangulation(const TopoDS_Shape& shape);
+    void build();
 
-    // get faces that contribute to 'nodes_on_face' with all of its nodes
-    SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
-    while (face_iter && face_iter->more()) {
-        const SMDS_MeshFace* face = face_iter->next();
-        SMDS_NodeIteratorPtr node_iter = face->nodeIterator();
+    using Tree = bgi::rtree<std::pair<Box3d, int>, bgi::quadratic<16>>;
+
+    std::vector<gp_Pnt> points;
+    // segments are stored as triangles whose last two points are equal
+    std::vector<std::array<int, 3>> triangles;
+    Tree tree;
+    double deflection = 0.0;
+};
 
-        // all nodes of the current face must be part of 'nodes_on_face'
-        std::set<int> node_ids;
-        while (node_iter && node_iter->more()) {
-            const SMDS_MeshNode* node = node_iter->next();
-            node_ids.insert(node->GetID());
+bool BoundaryIndex::addFaces(const TopoDS_Shape& shape)
+{
+    if (!addTriangulation(shape)) {
+        points.clear();
+        triangles.clear();
+        deflection = 0.0;
+
+        Bnd_Box box;
+        BRepBndLib::Add(shape, box);
+        if (box.IsVoid()) {
+            return false;
         }
 
-        std::vector<int> element_face_nodes;
-        std::set_intersection(nodes_on_face.begin(),
-                              nodes_on_face.end(),
-                              node_ids.begin(),
-                              node_ids.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_face_nodes));
+        // mesh a copy to not touch the triangulation of the document's shape
+        TopoDS_Shape copy = BRepBuilderAPI_Copy(shape).Shape();
+        BRepMesh_IncrementalMesh mesher(copy, 0.005 * std::sqrt(box.SquareExtent()));
+        if (!addTriangulation(copy)) {
+            return false;
+        }
+    }
+
+    build();
+    return true;
+}
+
+bool BoundaryIndex::addTriangulation(const TopoDS_Shape& shape)
+{
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(xp.Current());
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+        // without a known deflection the triangulation is useless as filter
+        if (mesh.IsNull() || mesh->Deflection() <= 0.0) {
+            return false;
+        }
 
-        if (element_face_nodes.size() == node_ids.size()) {
-            face_nodes[face->GetID()] = node_ids;
+        std::vector<gp_Pnt> nodes;
+        std::vector<Poly_Triangle> facets;
+        if (!Part::Tools::getTriangulation(face, nodes, facets)) {
+            return false;
         }
+
+        int offset = static_cast<int>(points.size());
+        points.insert(points.end(), nodes.begin(), nodes.end());
+        for (const auto& it : facets) {
+            Standard_Integer n1, n2, n3;
+            it.Get(n1, n2, n3);
+            triangles.push_back({offset + n1, offset + n2, offset + n3});
+        }
+
+        double scale = std::abs(loc.Transformation().ScaleFactor());
+        deflection = std::max(deflection, scale * mesh->Deflection());
     }
 
-    // get all nodes of a volume and check which faces contribute to it with all of its nodes
-    SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    while (vol_iter->more()) {
-        const SMDS_MeshVolume* vol = vol_iter->next();
-        SMDS_NodeIteratorPtr node_iter = vol->nodeIterator();
-        std::set<int> node_ids;
-        while (node_iter && node_iter->more()) {
-            const SMDS_MeshNode* node = node_iter->next();
-            node_ids.insert(node->GetID());
+    return !triangles.empty();
+}
+
+bool BoundaryIndex::addEdge(const TopoDS_Edge& edge)
+{
+    if (BRep_Tool::Degenerated(edge)) {
+        return false;
+    }
+
+    Bnd_Box box;
+    BRepBndLib::Add(edge, box);
+    if (box.IsVoid()) {
+        return false;
+    }
+
+    double defl = 0.005 * std::sqrt(box.SquareExtent());
+    if (defl <= 0.0) {
+        return false;
+    }
+
+    BRepAdaptor_Curve curve(edge);
+    GCPnts_QuasiUniformDeflection discretizer(curve, defl);
+    if (!discretizer.IsDone() || discretizer.NbPoints() < 2) {
+        return false;
+    }
+
+    for (int i = 1; i <= discretizer.NbPoints(); ++i) {
+        points.push_back(discretizer.Value(i));
+        if (i > 1) {
+            int last = static_cast<int>(points.size()) - 1;
+            triangles.push_back({last - 1, last, last});
+        }
+    }
+
+    deflection = defl;
+    build();
+    return true;
+}
+
+void BoundaryIndex::build()
+{
+    std::vector<std::pair<Box3d, int>> boxes;
+    boxes.reserve(triangles.size());
+    for (std::size_t i = 0; i < triangles.size(); ++i) {
+        Box3d box;
+        bg::assign_inverse(box);
+        for (int index : triangles[i]) {
+            const gp_Pnt& pnt = points[index];
+            bg::expand(box, Point3d(pnt.X(), pnt.Y(), pnt.Z()));
+        }
+        boxes.emplace_back(box, static_cast<int>(i));
+    }
+
+    // use the packing algorithm
+    tree = Tree(boxes.begin(), boxes.end());
+}
+
+bool BoundaryIndex::isNear(const gp_Pnt& pnt, double dist) const
+{
+    for (auto it = tree.qbegin(bgi::intersects(makeBox(pnt, dist))); it != tree.qend(); ++it) {
+        const auto& tria = triangles[it->second];
+        if (distanceToTriangle(pnt, points[tria[0]], points[tria[1]], points[tria[2]]) <= dist) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Exact distance check, the shape must already be loaded as first shape
+bool isCloserThan(BRepExtrema_DistShapeShape& measure, const gp_Pnt& pnt, double limit)
+{
+    measure.LoadS2(BRepBuilderAPI_MakeVertex(pnt).Vertex());
+    measure.Perform();
+    return measure.IsDone() && measure.NbSolution() > 0 && measure.Value() < limit;
+}
+
+std::set<int> selectNodes(const NodeList& nodes, const std::vector<char>& selection)
+{
+    std::set<int> result;
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        if (selection[i]) {
+            result.insert(nodes[i].first);
+        }
+    }
+    return result;
+}
+
+/// Elements of the given type that use at least one of the nodes, sorted by ID
+std::map<int, const SMDS_MeshElement*>
+getAttachedElements(const SMESHDS_Mesh* data, const std::set<int>& nodes, SMDSAbs_ElementType type)
+{
+    std::map<int, const SMDS_MeshElement*> elements;
+    for (int id : nodes) {
+        const SMDS_MeshNode* node = data->FindNode(id);
+        if (!node) {
+            continue;
+        }
+        SMDS_ElemIteratorPtr it = node->GetInverseElementIterator(type);
+        while (it->more()) {
+            const SMDS_MeshElement* elem = it->next();
+            elements.emplace(elem->GetID(), elem);
         }
+    }
+    return elements;
+}
+
+bool hasAllNodesIn(const SMDS_MeshElement* elem, const std::set<int>& nodes)
+{
+    for (int i = 0; i < elem->NbNodes(); i++) {
+        if (nodes.count(elem->GetNode(i)->GetID()) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool hasAllNodesOf(const SMDS_MeshElement* elem, const SMDS_MeshElement* sub)
+{
+    for (int i = 0; i < sub->NbNodes(); i++) {
+        if (elem->GetNodeIndex(sub->GetNode(i)) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
 
-        for (const auto& it : face_nodes) {
-            std::vector<int> element_face_nodes;
-            std::set_intersection(node_ids.begin(),
-                                  node_ids.end(),
-                                  it.second.begin(),
-                                  it.second.end(),
-                                  std::back_insert_iterator<std::vector<int>>(element_face_nodes));
+/*! That function returns map containing volume ID and face ID.
+ */
+std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face) const
+{
+    std::list<std::pair<int, int>> result;
+    std::set<int> nodes_on_face = getNodesByFace(face);
+    const SMESHDS_Mesh* data = myMesh->GetMeshDS();
+
+    // SMDS_MeshVolume::facesIterator() is broken with SMESH7 as it is impossible
+    // to iterate volume faces
+    // In SMESH9 this function has been removed
+    //
+    // Only faces attached to 'nodes_on_face' are checked. The faces must
+    // contribute with all of their nodes.
+    for (const auto& it : getAttachedElements(data, nodes_on_face, SMDSAbs_Face)) {
+        const SMDS_MeshElement* elem = it.second;
+        if (!hasAllNodesIn(elem, nodes_on_face)) {
+            continue;
+        }
 
-            // For curved faces it is possible that a volume contributes more than one face
-            if (element_face_nodes.size() == it.second.size()) {
-                result.emplace_back(vol->GetID(), it.first);
+        // A volume that contains all nodes of the face is attached to each of
+        // them, so it's sufficient to check the volumes of the first node.
+        // For curved faces it is possible that a volume contributes more than one face
+        SMDS_ElemIteratorPtr vol_iter = elem->GetNode(0)->GetInverseElementIterator(SMDSAbs_Volume);
+        while (vol_iter->more()) {
+            const SMDS_MeshElement* vol = vol_iter->next();
+            if (hasAllNodesOf(vol, elem)) {
+                result.emplace_back(vol->GetID(), elem->GetID());
             }
         }
     }
+
     result.sort();
     return result;
 }
@@ -412,30 +661,14 @@ std::list<int> FemMesh::getFacesByFace(const TopoDS_Face& face) const
     std::list<int> result;
     std::set<int> nodes_on_face = getNodesByFace(face);
 
-    SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
-    while (face_iter->more()) {
-        const SMDS_MeshFace* face = static_cast<const SMDS_MeshFace*>(face_iter->next());
-        int numNodes = face->NbNodes();
-
-        std::set<int> face_nodes;
-        for (int i = 0; i < numNodes; i++) {
-            face_nodes.insert(face->GetNode(i)->GetID());
-        }
-
-        std::vector<int> element_face_nodes;
-        std::set_intersection(nodes_on_face.begin(),
-                              nodes_on_face.end(),
-                              face_nodes.begin(),
-                              face_nodes.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_face_nodes));
-
-        // For curved faces it is possible that a volume contributes more than one face
-        if (element_face_nodes.size() == static_cast<std::size_t>(numNodes)) {
-            result.push_back(face->GetID());
+    // only faces attached to 'nodes_on_face' can contribute with all of their nodes
+    for (const auto& it :
+         getAttachedElements(myMesh->GetMeshDS(), nodes_on_face, SMDSAbs_Face)) {
+        if (hasAllNodesIn(it.second, nodes_on_face)) {
+            result.push_back(it.first);
         }
     }
 
-    result.sort();
     return result;
 }
 
@@ -444,29 +677,13 @@ std::list<int> FemMesh::getEdgesByEdge(const TopoDS_Edge& edge) const
     std::list<int> result;
     std::set<int> nodes_on_edge = getNodesByEdge(edge);
 
-    SMDS_EdgeIteratorPtr edge_iter = myMesh->GetMeshDS()->edgesIterator();
-    while (edge_iter->more()) {
-        const SMDS_MeshEdge* edge = static_cast<const SMDS_MeshEdge*>(edge_iter->next());
-        int numNodes = edge->NbNodes();
-
-        std::set<int> edge_nodes;
-        for (int i = 0; i < numNodes; i++) {
-            edge_nodes.insert(edge->GetNode(i)->GetID());
-        }
-
-        std::vector<int> element_edge_nodes;
-        std::set_intersection(nodes_on_edge.begin(),
-                              nodes_on_edge.end(),
-                              edge_nodes.begin(),
-                              edge_nodes.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_edge_nodes));
-
-        if (element_edge_nodes.size() == static_cast<std::size_t>(numNodes)) {
-            result.push_back(edge->GetID());
+    for (const auto& it :
+         getAttachedElements(myMesh->GetMeshDS(), nodes_on_edge, SMDSAbs_Edge)) {
+        if (hasAllNodesIn(it.second, nodes_on_edge)) {
+            result.push_back(it.first);
         }
     }
 
-    result.sort();
     return result;
 }
 
@@ -488,11 +705,12 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
         elem_order.insert(std::make_pair(c3d10.size(), c3d10));
     }
 
-    SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    std::set<int> element_nodes;
+    // only volumes attached to 'nodes_on_face' can have a face on it
+    std::map<int, const SMDS_MeshElement*> volumes =
+        getAttachedElements(myMesh->GetMeshDS(), nodes_on_face, SMDSAbs_Volume);
     int num_of_nodes;
-    while (vol_iter->more()) {
-        const SMDS_MeshVolume* vol = vol_iter->next();
+    for (const auto& vol_it : volumes) {
+        const SMDS_MeshElement* vol = vol_it.second;
         num_of_nodes = vol->NbNodes();
         std::pair<int, std::vector<int>> apair;
         apair.first = vol->GetID();
@@ -557,10 +775,74 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
     return result;
 }
 
-std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
+struct FemMesh::NodeIndex
 {
-    std::set<int> result;
+    using Value = std::pair<Point3d, int>;
+
+    bgi::rtree<Value, bgi::quadratic<16>> tree;
+    Base::Matrix4D matrix;
+    std::size_t numNodes = 0;
+
+    /// IDs and absolute positions of the nodes inside the box
+    NodeList nodesInBox(const Bnd_Box& box) const
+    {
+        NodeList nodes;
+        if (box.IsVoid()) {
+            return nodes;
+        }
+
+        double xmin, ymin, zmin, xmax, ymax, zmax;
+        box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        Box3d query(Point3d(xmin, ymin, zmin), Point3d(xmax, ymax, zmax));
+        for (auto it = tree.qbegin(bgi::intersects(query)); it != tree.qend(); ++it) {
+            const Point3d& pnt = it->first;
+            nodes.emplace_back(it->second,
+                               gp_Pnt(bg::get<0>(pnt), bg::get<1>(pnt), bg::get<2>(pnt)));
+        }
+        return nodes;
+    }
+};
+
+std::shared_ptr<const FemMesh::NodeIndex> FemMesh::getNodeIndex() const
+{
+    std::lock_guard<std::mutex> lock(nodeIndexMutex);
+    const SMESHDS_Mesh* data = myMesh->GetMeshDS();
+    auto numNodes = static_cast<std::size_t>(data->NbNodes());
+    // Besides the explicit invalidation check the number of nodes and the
+    // placement which may be changed without calling invalidateNodeIndex()
+    if (nodeIndex && nodeIndex->numNodes == numNodes && nodeIndex->matrix == _Mtrx) {
+        return nodeIndex;
+    }
+
+    auto index = std::make_shared<NodeIndex>();
+    index->matrix = _Mtrx;
+    index->numNodes = numNodes;
+
+    std::vector<NodeIndex::Value> values;
+    values.reserve(numNodes);
+    SMDS_NodeIteratorPtr aNodeIter = data->nodesIterator();
+    while (aNodeIter->more()) {
+        const SMDS_MeshNode* aNode = aNodeIter->next();
+        Base::Vector3d vec(aNode->X(), aNode->Y(), aNode->Z());
+        // Apply the matrix to hold the index in absolute space.
+        vec = _Mtrx * vec;
+        values.emplace_back(Point3d(vec.x, vec.y, vec.z), aNode->GetID());
+    }
+
+    // use the packing algorithm
+    index->tree = decltype(index->tree)(values.begin(), values.end());
+    nodeIndex = index;
+    return nodeIndex;
+}
 
+void FemMesh::invalidateNodeIndex()
+{
+    std::lock_guard<std::mutex> lock(nodeIndexMutex);
+    nodeIndex.reset();
+}
+
+std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
+{
     Bnd_Box box;
     BRepBndLib::Add(solid, box);
 
@@ -572,50 +854,39 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
                         limit,
                         limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
+    NodeList nodes = getNodeIndex()->nodesInBox(box);
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
+    // Nodes that are away from the boundary only need to be classified,
+    // the exact distance is computed for the nodes close to it
+    BoundaryIndex boundary;
+    bool useFilter = boundary.addFaces(solid);
+    double band = limit + 2.0 * boundary.getDeflection();
 
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
+    std::vector<char> inside(nodes.size(), 0);
+#pragma omp parallel
+    {
+        BRepClass3d_SolidClassifier classifier(solid);
+        BRepExtrema_DistShapeShape measure;
+        measure.LoadS1(solid);
+
+#pragma omp for schedule(dynamic)
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            const gp_Pnt& pnt = nodes[i].second;
+            if (useFilter && !boundary.isNear(pnt, band)) {
+                classifier.Perform(pnt, limit);
+                inside[i] = classifier.State() == TopAbs_IN;
             }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
+            else {
+                inside[i] = isCloserThan(measure, pnt, limit);
             }
         }
     }
-    return result;
+
+    return selectNodes(nodes, inside);
 }
 
 std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(
         face,
@@ -625,96 +896,64 @@ std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
     double limit = BRep_Tool::Tolerance(face);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
+    NodeList nodes = getNodeIndex()->nodesInBox(box);
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
+    // Nodes that are away from the triangulation can't be on the face,
+    // the exact distance is only computed for the others
+    BoundaryIndex boundary;
+    bool useFilter = boundary.addFaces(face);
+    double band = limit + 2.0 * boundary.getDeflection();
 
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
+    std::vector<char> onFace(nodes.size(), 0);
+#pragma omp parallel
+    {
+        BRepExtrema_DistShapeShape measure;
+        measure.LoadS1(face);
+
+#pragma omp for schedule(dynamic)
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            const gp_Pnt& pnt = nodes[i].second;
+            if (!useFilter || boundary.isNear(pnt, band)) {
+                onFace[i] = isCloserThan(measure, pnt, limit);
             }
         }
     }
 
-    return result;
+    return selectNodes(nodes, onFace);
 }
 
 std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(edge, box);
     // limit where the mesh node belongs to the edge:
     double limit = BRep_Tool::Tolerance(edge);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
+    NodeList nodes = getNodeIndex()->nodesInBox(box);
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
+    // Nodes that are away from the polygon can't be on the edge,
+    // the exact distance is only computed for the others
+    BoundaryIndex boundary;
+    bool useFilter = boundary.addEdge(edge);
+    double band = limit + 2.0 * boundary.getDeflection();
 
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
+    std::vector<char> onEdge(nodes.size(), 0);
+#pragma omp parallel
+    {
+        BRepExtrema_DistShapeShape measure;
+        measure.LoadS1(edge);
+
+#pragma omp for schedule(dynamic)
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            const gp_Pnt& pnt = nodes[i].second;
+            if (!useFilter || boundary.isNear(pnt, band)) {
+                onEdge[i] = isCloserThan(measure, pnt, limit);
             }
         }
     }
 
-    return result;
+    return selectNodes(nodes, onEdge);
 }
 
 std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
@@ -722,32 +961,16 @@ std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
     std::set<int> result;
 
     double limit = BRep_Tool::Tolerance(vertex);
-    limit *= limit;  // use square to improve speed
     gp_Pnt pnt = BRep_Tool::Pnt(vertex);
-    Base::Vector3d node(pnt.X(), pnt.Y(), pnt.Z());
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        vec = Mtrx * vec;
+    Bnd_Box box;
+    box.Add(pnt);
+    box.Enlarge(limit);
 
-        if (Base::DistanceP2(node, vec) <= limit)
-#pragma omp critical
-        {
-            result.insert(aNode->GetID());
+    limit *= limit;  // use square to improve speed
+    for (const auto& it : getNodeIndex()->nodesInBox(box)) {
+        if (it.second.SquareDistance(pnt) <= limit) {
+            result.insert(it.first);
         }
     }
 
@@ -1601,6 +1824,7 @@ void FemMesh::read(const char* FileName)
 {
     Base::FileInfo File(FileName);
     _Mtrx = Base::Matrix4D();
+    invalidateNodeIndex();
 
     // checking on the file
     if (!File.isReadable()) {
@@ -2397,6 +2621,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
     file.close();
 
     // read the shape from the temp file
+    invalidateNodeIndex();
     myMesh->UNVToMesh(fi.filePath().c_str());
 
     // delete the temp file
@@ -2406,6 +2631,7 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
 void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 {
     // We perform a translation and rotation of the current active Mesh object
+    invalidateNodeIndex();
     Base::Matrix4D clMatrix(rclTrf);
     SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
     Base::Vector3d current_node;
@@ -25,6 +25,7 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <SMDSAbs_ElementType.hxx>
@@ -91,6 +92,7 @@ public:
 
     FemMesh& operator=(const FemMesh&);
     const SMESH_Mesh* getSMesh() const;
+    /// Write access to the mesh, the node index is rebuilt on the next search
     SMESH_Mesh* getSMesh();
     static SMESH_Gen* getGenerator();
     void addHypothesis(const TopoDS_Shape& aSubShape, SMESH_HypothesisPtr hyp);
@@ -220,6 +222,12 @@ private:
     void readZ88(const std::string& Filename);
     void readAbaqus(const std::string& Filename);
 
+    struct NodeIndex;
+    /// Spatial index of the nodes in absolute space, built on demand
+    std::shared_ptr<const NodeIndex> getNodeIndex() const;
+    /// Must be called whenever nodes are added, removed or moved
+    void invalidateNodeIndex();
+
 private:
     /// positioning matrix
     Base::Matrix4D _Mtrx;
@@ -228,6 +236,9 @@ private:
 
     std::list<SMESH_HypothesisPtr> hypoth;
     static SMESH_Gen* _mesh_gen;
+
+    mutable std::shared_ptr<const NodeIndex> nodeIndex;
+    mutable std::mutex nodeIndexMutex;
 };
 
 
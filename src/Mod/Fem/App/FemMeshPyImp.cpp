@@ -59,11 +59,27 @@
 
 using namespace Fem;
 
+namespace
+{
+// The non-const FemMesh::getSMesh() drops the node index of the mesh, because the caller may
+// modify the nodes. Read-only access goes through the const overload instead.
+const SMESH_Mesh* getConstSMesh(const FemMesh* mesh)
+{
+    return mesh->getSMesh();
+}
+
+// for the lookups that don't modify the mesh, but aren't declared const by SMESH
+SMESH_Mesh* getLookupSMesh(const FemMesh* mesh)
+{
+    return const_cast<SMESH_Mesh*>(mesh->getSMesh());  // NOLINT
+}
+}  // namespace
+
 // returns a string which represents the object e.g. when printed in python
 std::string FemMeshPy::representation() const
 {
     std::stringstream str;
-    getFemMeshPtr()->getSMesh()->Dump(str);
+    getLookupSMesh(getFemMeshPtr())->Dump(str);
     return str.str();
 }
 
@@ -1372,7 +1388,7 @@ PyObject* FemMeshPy::getNodeById(PyObject* args)
     }
 
     Base::Matrix4D Mtrx = getFemMeshPtr()->getTransform();
-    const SMDS_MeshNode* aNode = getFemMeshPtr()->getSMesh()->GetMeshDS()->FindNode(id);
+    const SMDS_MeshNode* aNode = getConstSMesh(getFemMeshPtr())->GetMeshDS()->FindNode(id);
 
     if (aNode) {
         Base::Vector3d vec(aNode->X(), aNode->Y(), aNode->Z());
@@ -1571,7 +1587,7 @@ PyObject* FemMeshPy::getGroupName(PyObject* args)
         return nullptr;
     }
 
-    SMESH_Group* group = getFemMeshPtr()->getSMesh()->GetGroup(id);
+    SMESH_Group* group = getLookupSMesh(getFemMeshPtr())->GetGroup(id);
     if (!group) {
         PyErr_SetString(PyExc_ValueError, "No group for given id");
         return nullptr;
@@ -1586,7 +1602,7 @@ PyObject* FemMeshPy::getGroupElementType(PyObject* args)
         return nullptr;
     }
 
-    SMESH_Group* group = getFemMeshPtr()->getSMesh()->GetGroup(id);
+    SMESH_Group* group = getLookupSMesh(getFemMeshPtr())->GetGroup(id);
     if (!group) {
         PyErr_SetString(PyExc_ValueError, "No group for given id");
         return nullptr;
@@ -1609,7 +1625,7 @@ PyObject* FemMeshPy::getGroupElements(PyObject* args)
         return nullptr;
     }
 
-    SMESH_Group* group = getFemMeshPtr()->getSMesh()->GetGroup(id);
+    SMESH_Group* group = getLookupSMesh(getFemMeshPtr())->GetGroup(id);
     if (!group) {
         PyErr_SetString(PyExc_ValueError, "No group for given id");
         return nullptr;
@@ -1729,10 +1745,10 @@ PyObject* FemMeshPy::getElementType(PyObject* args)
     }
 
     // An element ...
-    SMDSAbs_ElementType elemType = getFemMeshPtr()->getSMesh()->GetElementType(id, true);
+    SMDSAbs_ElementType elemType = getLookupSMesh(getFemMeshPtr())->GetElementType(id, true);
     // ... or a node
     if (elemType == SMDSAbs_All) {
-        elemType = getFemMeshPtr()->getSMesh()->GetElementType(id, false);
+        elemType = getLookupSMesh(getFemMeshPtr())->GetElementType(id, false);
     }
 
     auto it =
@@ -1768,7 +1784,7 @@ PyObject* FemMeshPy::getIdByElementType(PyObject* args)
     SMDSAbs_ElementType elemType = it->second;
     std::set<int> ids;
     SMDS_ElemIteratorPtr aElemIter =
-        getFemMeshPtr()->getSMesh()->GetMeshDS()->elementsIterator(elemType);
+        getConstSMesh(getFemMeshPtr())->GetMeshDS()->elementsIterator(elemType);
     while (aElemIter->more()) {
         const SMDS_MeshElement* aElem = aElemIter->next();
         ids.insert(aElem->GetID());
@@ -1794,7 +1810,7 @@ Py::Dict FemMeshPy::getNodes() const
     // get the actual transform of the FemMesh
     Base::Matrix4D Mtrx = getFemMeshPtr()->getTransform();
 
-    SMDS_NodeIteratorPtr aNodeIter = getFemMeshPtr()->getSMesh()->GetMeshDS()->nodesIterator();
+    SMDS_NodeIteratorPtr aNodeIter = getConstSMesh(getFemMeshPtr())->GetMeshDS()->nodesIterator();
     while (aNodeIter->more()) {
         const SMDS_MeshNode* aNode = aNodeIter->next();
         Base::Vector3d vec(aNode->X(), aNode->Y(), aNode->Z());
@@ -1810,13 +1826,13 @@ Py::Dict FemMeshPy::getNodes() const
 
 Py::Long FemMeshPy::getNodeCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbNodes());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbNodes());
 }
 
 Py::Tuple FemMeshPy::getEdges() const
 {
     std::set<int> ids;
-    SMDS_EdgeIteratorPtr aEdgeIter = getFemMeshPtr()->getSMesh()->GetMeshDS()->edgesIterator();
+    SMDS_EdgeIteratorPtr aEdgeIter = getConstSMesh(getFemMeshPtr())->GetMeshDS()->edgesIterator();
     while (aEdgeIter->more()) {
         const SMDS_MeshEdge* aEdge = aEdgeIter->next();
         ids.insert(aEdge->GetID());
@@ -1845,13 +1861,13 @@ Py::Tuple FemMeshPy::getEdgesOnly() const
 
 Py::Long FemMeshPy::getEdgeCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbEdges());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbEdges());
 }
 
 Py::Tuple FemMeshPy::getFaces() const
 {
     std::set<int> ids;
-    SMDS_FaceIteratorPtr aFaceIter = getFemMeshPtr()->getSMesh()->GetMeshDS()->facesIterator();
+    SMDS_FaceIteratorPtr aFaceIter = getConstSMesh(getFemMeshPtr())->GetMeshDS()->facesIterator();
     while (aFaceIter->more()) {
         const SMDS_MeshFace* aFace = aFaceIter->next();
         ids.insert(aFace->GetID());
@@ -1880,28 +1896,29 @@ Py::Tuple FemMeshPy::getFacesOnly() const
 
 Py::Long FemMeshPy::getFaceCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbFaces());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbFaces());
 }
 
 Py::Long FemMeshPy::getTriangleCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbTriangles());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbTriangles());
 }
 
 Py::Long FemMeshPy::getQuadrangleCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbQuadrangles());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbQuadrangles());
 }
 
 Py::Long FemMeshPy::getPolygonCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbPolygons());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbPolygons());
 }
 
 Py::Tuple FemMeshPy::getVolumes() const
 {
     std::set<int> ids;
-    SMDS_VolumeIteratorPtr aVolIter = getFemMeshPtr()->getSMesh()->GetMeshDS()->volumesIterator();
+    SMDS_VolumeIteratorPtr aVolIter =
+        getConstSMesh(getFemMeshPtr())->GetMeshDS()->volumesIterator();
     while (aVolIter->more()) {
         const SMDS_MeshVolume* aVol = aVolIter->next();
         ids.insert(aVol->GetID());
@@ -1918,47 +1935,47 @@ Py::Tuple FemMeshPy::getVolumes() const
 
 Py::Long FemMeshPy::getVolumeCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbVolumes());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbVolumes());
 }
 
 Py::Long FemMeshPy::getTetraCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbTetras());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbTetras());
 }
 
 Py::Long FemMeshPy::getHexaCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbHexas());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbHexas());
 }
 
 Py::Long FemMeshPy::getPyramidCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbPyramids());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbPyramids());
 }
 
 Py::Long FemMeshPy::getPrismCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbPrisms());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbPrisms());
 }
 
 Py::Long FemMeshPy::getPolyhedronCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbPolyhedrons());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbPolyhedrons());
 }
 
 Py::Long FemMeshPy::getSubMeshCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbSubMesh());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbSubMesh());
 }
 
 Py::Long FemMeshPy::getGroupCount() const
 {
-    return Py::Long(getFemMeshPtr()->getSMesh()->NbGroup());
+    return Py::Long(getConstSMesh(getFemMeshPtr())->NbGroup());
 }
 
 Py::Tuple FemMeshPy::getGroups() const
 {
-    std::list<int> groupIDs = getFemMeshPtr()->getSMesh()->GetGroupIds();
+    std::list<int> groupIDs = getConstSMesh(getFemMeshPtr())->GetGroupIds();
 
     Py::Tuple tuple(groupIDs.size());
     int index = 0;
@@ -73,15 +73,29 @@ DocumentObjectExecReturn* FemPostFilter::execute()
             return StdReturn;
         }
 
+        // VTK only re-executes the pipeline if the input object, its data or the filter
+        // parameters have changed. The input object is the Data of the upstream object
+        // which is only replaced if its result has changed.
+        vtkDataObject* output = nullptr;
         if ((m_activePipeline == "DataAlongLine") || (m_activePipeline == "DataAtPoint")) {
-            pipe.filterSource->SetSourceData(getInputData());
+            pipe.filterSource->SetSourceData(data);
             pipe.filterTarget->Update();
-            Data.setValue(pipe.filterTarget->GetOutputDataObject(0));
+            output = pipe.filterTarget->GetOutputDataObject(0);
         }
         else {
             pipe.source->SetInputDataObject(data);
             pipe.target->Update();
-            Data.setValue(pipe.target->GetOutputDataObject(0));
+            output = pipe.target->GetOutputDataObject(0);
+        }
+
+        // If the pipeline has not been executed the result is unchanged and setting
+        // it again would only update the view providers and downstream filters for nothing
+        if (output != m_output.GetPointer() || output->GetMTime() != m_outputTime
+            || Data.getValue().GetPointer() != m_data.GetPointer()) {
+            Data.setValue(output);
+            m_output = output;
+            m_outputTime = output->GetMTime();
+            m_data = Data.getValue().GetPointer();
         }
     }
 
@@ -35,6 +35,7 @@
 #include <vtkTableBasedClipDataSet.h>
 #include <vtkVectorNorm.h>
 #include <vtkWarpVector.h>
+#include <vtkWeakPointer.h>
 
 #include <App/PropertyUnits.h>
 #include <App/DocumentObjectExtension.h>
@@ -77,6 +78,13 @@ private:
     // handling of multiple pipelines which can be the filter
     std::map<std::string, FilterPipeline> m_pipelines;
     std::string m_activePipeline;
+
+    // last result of the active pipeline, used to not set the same data again. The
+    // pointers are weak, so an object that was freed meanwhile (e.g. the Data replaced
+    // by undo/redo) can't be mistaken for a new one at the same address.
+    vtkWeakPointer<vtkDataObject> m_output;
+    vtkMTimeType m_outputTime = 0;
+    vtkWeakPointer<vtkDataObject> m_data;
 };
 
 class FemExport FemPostSmoothFilterExtension: public App::DocumentObjectExtension
@@ -25,8 +25,10 @@
 #ifndef _PreComp_
 #include <Python.h>
 #include <vtkAppendFilter.h>
+#include <vtkDataArray.h>
 #include <vtkDataSetReader.h>
 #include <vtkImageData.h>
+#include <vtkPointData.h>
 #include <vtkRectilinearGrid.h>
 #include <vtkStructuredGrid.h>
 #include <vtkUnstructuredGrid.h>
@@ -140,6 +142,39 @@ void FemPostPipeline::scale(double s)
     Data.scale(s);
 }
 
+void FemPostPipeline::scaleField(vtkDataSet* dset, vtkDataArray* pdata, double FieldFactor)
+{
+    // safe guard
+    if (!dset || !pdata) {
+        return;
+    }
+
+    // the array is shared with the copies of the data set, thus scale a copy
+    // and replace the array by it
+    vtkSmartPointer<vtkDataArray> scaled;
+    scaled.TakeReference(pdata->NewInstance());
+    scaled->DeepCopy(pdata);
+
+    // step through all mesh points and scale them
+    for (int i = 0; i < dset->GetNumberOfPoints(); ++i) {
+        double value = 0;
+        if (scaled->GetNumberOfComponents() == 1) {
+            value = scaled->GetComponent(i, 0);
+            scaled->SetComponent(i, 0, value * FieldFactor);
+        }
+        // if field is a vector
+        else {
+            for (int j = 0; j < scaled->GetNumberOfComponents(); ++j) {
+                value = scaled->GetComponent(i, j);
+                scaled->SetComponent(i, j, value * FieldFactor);
+            }
+        }
+    }
+
+    // an array with the same name is replaced
+    dset->GetPointData()->AddArray(scaled);
+}
+
 void FemPostPipeline::onChanged(const Property* prop)
 {
     if (prop == &Filter || prop == &Mode) {
@@ -29,6 +29,8 @@
 
 #include <vtkSmartPointer.h>
 
+class vtkDataArray;
+class vtkDataSet;
 
 namespace Fem
 {
@@ -59,6 +61,7 @@ public:
     static bool canRead(Base::FileInfo file);
     void read(Base::FileInfo file);
     void scale(double s);
+    static void scaleField(vtkDataSet* dset, vtkDataArray* pdata, double FieldFactor);
 
     // load from results
     void load(FemResultObject* res);
@@ -27,6 +27,8 @@
 #include <vtkCompositeDataSet.h>
 #include <vtkMultiBlockDataSet.h>
 #include <vtkMultiPieceDataSet.h>
+#include <vtkPointSet.h>
+#include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkRectilinearGrid.h>
 #include <vtkStructuredGrid.h>
@@ -60,9 +62,30 @@ PropertyPostDataObject::PropertyPostDataObject() = default;
 
 PropertyPostDataObject::~PropertyPostDataObject() = default;
 
+namespace
+{
+// The arrays of a shallow copy are shared with the original, thus a data
+// object must be detached before it is modified
+vtkSmartPointer<vtkDataObject> detach(vtkDataObject* dataObject)
+{
+    vtkSmartPointer<vtkDataObject> copy;
+    copy.TakeReference(dataObject->NewInstance());
+    copy->ShallowCopy(dataObject);
+    return copy;
+}
+}  // namespace
+
 void PropertyPostDataObject::scaleDataObject(vtkDataObject* dataObject, double s)
 {
-    auto scalePoints = [](vtkPoints* points, double s) {
+    auto scalePoints = [](vtkPointSet* dataSet, double s) {
+        vtkPoints* source = dataSet->GetPoints();
+        if (!source) {
+            return;
+        }
+
+        // the points may be shared with other data objects
+        vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+        points->DeepCopy(source);
         for (vtkIdType i = 0; i < points->GetNumberOfPoints(); i++) {
             double xyz[3];
             points->GetPoint(i, xyz);
@@ -71,30 +94,32 @@ void PropertyPostDataObject::scaleDataObject(vtkDataObject* dataObject, double s
             }
             points->SetPoint(i, xyz);
         }
+        dataSet->SetPoints(points);
     };
 
-    if (dataObject->GetDataObjectType() == VTK_POLY_DATA) {
-        vtkPolyData* dataSet = vtkPolyData::SafeDownCast(dataObject);
-        scalePoints(dataSet->GetPoints(), s);
-    }
-    else if (dataObject->GetDataObjectType() == VTK_STRUCTURED_GRID) {
-        vtkStructuredGrid* dataSet = vtkStructuredGrid::SafeDownCast(dataObject);
-        scalePoints(dataSet->GetPoints(), s);
-    }
-    else if (dataObject->GetDataObjectType() == VTK_UNSTRUCTURED_GRID) {
-        vtkUnstructuredGrid* dataSet = vtkUnstructuredGrid::SafeDownCast(dataObject);
-        scalePoints(dataSet->GetPoints(), s);
+    if (dataObject->GetDataObjectType() == VTK_POLY_DATA
+        || dataObject->GetDataObjectType() == VTK_STRUCTURED_GRID
+        || dataObject->GetDataObjectType() == VTK_UNSTRUCTURED_GRID) {
+        scalePoints(vtkPointSet::SafeDownCast(dataObject), s);
     }
     else if (dataObject->GetDataObjectType() == VTK_MULTIBLOCK_DATA_SET) {
         vtkMultiBlockDataSet* dataSet = vtkMultiBlockDataSet::SafeDownCast(dataObject);
         for (unsigned int i = 0; i < dataSet->GetNumberOfBlocks(); i++) {
-            scaleDataObject(dataSet->GetBlock(i), s);
+            if (vtkDataObject* block = dataSet->GetBlock(i)) {
+                vtkSmartPointer<vtkDataObject> copy = detach(block);
+                scaleDataObject(copy, s);
+                dataSet->SetBlock(i, copy);
+            }
         }
     }
     else if (dataObject->GetDataObjectType() == VTK_MULTIPIECE_DATA_SET) {
         vtkMultiPieceDataSet* dataSet = vtkMultiPieceDataSet::SafeDownCast(dataObject);
         for (unsigned int i = 0; i < dataSet->GetNumberOfPieces(); i++) {
-            scaleDataObject(dataSet->GetPiece(i), s);
+            if (vtkDataObject* piece = dataSet->GetPiece(i)) {
+                vtkSmartPointer<vtkDataObject> copy = detach(piece);
+                scaleDataObject(copy, s);
+                dataSet->SetPiece(i, copy);
+            }
         }
     }
 }
@@ -103,6 +128,7 @@ void PropertyPostDataObject::scale(double s)
 {
     if (m_dataObject) {
         aboutToSetValue();
+        m_dataObject = detach(m_dataObject);
         scaleDataObject(m_dataObject, s);
         hasSetValue();
     }
@@ -114,7 +140,7 @@ void PropertyPostDataObject::setValue(const vtkSmartPointer<vtkDataObject>& ds)
 
     if (ds) {
         createDataObjectByExternalType(ds);
-        m_dataObject->DeepCopy(ds);
+        m_dataObject->ShallowCopy(ds);
     }
     else {
         m_dataObject = nullptr;
@@ -166,7 +192,7 @@ App::Property* PropertyPostDataObject::Copy() const
     if (m_dataObject) {
 
         prop->createDataObjectByExternalType(m_dataObject);
-        prop->m_dataObject->DeepCopy(m_dataObject);
+        prop->m_dataObject->ShallowCopy(m_dataObject);
     }
 
     return prop;
@@ -202,6 +228,8 @@ void PropertyPostDataObject::createDataObjectByExternalType(vtkSmartPointer<vtkD
             m_dataObject = vtkSmartPointer<vtkMultiPieceDataSet>::New();
             break;
         default:
+            // never reuse the old object, it may be shared with a copy
+            m_dataObject.TakeReference(ex->NewInstance());
             break;
     };
 }
@@ -426,7 +454,7 @@ void PropertyPostDataObject::RestoreDocFile(Base::Reader& reader)
         else {
             aboutToSetValue();
             createDataObjectByExternalType(xmlReader->GetOutputAsDataSet());
-            m_dataObject->DeepCopy(xmlReader->GetOutputAsDataSet());
+            m_dataObject->ShallowCopy(xmlReader->GetOutputAsDataSet());
             hasSetValue();
         }
     }
@@ -34,6 +34,10 @@ namespace Fem
 {
 
 /** The vtk data set property class.
+ * The property holds a shallow copy of the data set it is given, i.e. the
+ * points, cells and arrays are shared with the pipeline, the filters and
+ * the copies made for undo/redo. The data must therefore not be modified
+ * in place but replaced by a new data set.
  * @author Stefan Tröger
  */
 class FemExport PropertyPostDataObject: public App::Property
@@ -48,7 +52,7 @@ public:
     //@{
     /// Scale the point coordinates of the data set with factor \a s
     void scale(double s);
-    /// set the dataset
+    /// set the dataset, the arrays are shared and not copied
     void setValue(const vtkSmartPointer<vtkDataObject>&);
     /// get the part shape
     const vtkSmartPointer<vtkDataObject>& getValue() const;
@@ -161,9 +161,11 @@
 // VTK
 #include <vtkCellArray.h>
 #include <vtkCellData.h>
+#include <vtkDataArray.h>
 #include <vtkDoubleArray.h>
 #include <vtkLookupTable.h>
 #include <vtkPointData.h>
+#include <vtkSmartPointer.h>
 
 #endif  //_PreComp_
 
@@ -23,7 +23,9 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <vtkDataArray.h>
 #include <vtkPointData.h>
+#include <vtkSmartPointer.h>
 #endif
 
 #include <App/FeaturePythonPyImp.h>
@@ -216,26 +218,7 @@ void ViewProviderFemPostPipeline::scaleField(vtkDataSet* dset,
                                              vtkDataArray* pdata,
                                              double FieldFactor)
 {
-    // safe guard
-    if (!dset || !pdata) {
-        return;
-    }
-
-    // step through all mesh points and scale them
-    for (int i = 0; i < dset->GetNumberOfPoints(); ++i) {
-        double value = 0;
-        if (pdata->GetNumberOfComponents() == 1) {
-            value = pdata->GetComponent(i, 0);
-            pdata->SetComponent(i, 0, value * FieldFactor);
-        }
-        // if field is a vector
-        else {
-            for (int j = 0; j < pdata->GetNumberOfComponents(); ++j) {
-                value = pdata->GetComponent(i, j);
-                pdata->SetComponent(i, j, value * FieldFactor);
-            }
-        }
-    }
+    Fem::FemPostPipeline::scaleField(dset, pdata, FieldFactor);
 }
 
 PyObject* ViewProviderFemPostPipeline::getPyObject()
@@ -88,7 +88,12 @@ def importFrd(filename, analysis=None, result_name_prefix="", result_analysis_ty
             return res_obj
 
         if len(m["Results"]) > 0:
-            for result_set in m["Results"]:
+            # all result sets are parsed up front, but each one is dropped once its
+            # result object is filled, so they are not all kept until the end
+            results = m.pop("Results")
+            results.reverse()
+            while results:
+                result_set = results.pop()
                 if "number" in result_set:
                     eigenmode_number = result_set["number"]
                 else:
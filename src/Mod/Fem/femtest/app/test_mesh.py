@@ -192,6 +192,67 @@ class TestMeshCommon(unittest.TestCase):
             f"Problem in test_writeAbaqus_precision, \n{read_node_line}\n{expected}",
         )
 
+    # ********************************************************************************************
+    def test_nodes_elements_by_shape(self):
+        # tetra4 mesh of a 10 mm box: the surface of the box is split into two triangles per
+        # box face, each triangle is the base of a tetrahedron with the center node as tip
+        import Part
+
+        fm = Fem.FemMesh()
+        for k in range(2):
+            for j in range(2):
+                for i in range(2):
+                    fm.addNode(10 * i, 10 * j, 10 * k, 1 + i + 2 * j + 4 * k)
+        fm.addNode(5, 5, 5, 9)  # center, decided by the classifier
+        fm.addNode(20, 20, 20, 10)  # outside
+        fm.addNode(5, 5, 10.5, 11)  # outside, close to the top face
+        fm.addNode(5, 5, 9.5, 12)  # inside, close to the top face
+
+        box_faces = [
+            (1, 2, 4, 3),  # z = 0
+            (5, 6, 8, 7),  # z = 10
+            (1, 3, 7, 5),  # x = 0
+            (2, 4, 8, 6),  # x = 10
+            (1, 2, 6, 5),  # y = 0
+            (3, 4, 8, 7),  # y = 10
+        ]
+        for k, (a, b, c, d) in enumerate(box_faces):
+            fm.addFace([a, b, c], 2 * k + 1)
+            fm.addFace([a, c, d], 2 * k + 2)
+            # the tip is the last node of the first and the first node of the second volume,
+            # which gives the CalculiX faces 1 and 4
+            fm.addVolume([a, b, c, 9], 2 * k + 13)
+            fm.addVolume([9, a, c, d], 2 * k + 14)
+
+        # a new box has no triangulation, the second one is meshed before
+        box_new = Part.makeBox(10, 10, 10)
+        box_meshed = Part.makeBox(10, 10, 10)
+        box_meshed.tessellate(0.1)
+
+        for box in (box_new, box_meshed):
+            bottom = [f for f in box.Faces if abs(f.CenterOfMass.z) < 1e-7][0]
+            top = [f for f in box.Faces if abs(f.CenterOfMass.z - 10) < 1e-7][0]
+            edge = [
+                e
+                for e in bottom.Edges
+                if abs(e.CenterOfMass.y) < 1e-7 and abs(e.CenterOfMass.x - 5) < 1e-7
+            ][0]
+            vertex = [v for v in box.Vertexes if v.Point.Length < 1e-7][0]
+
+            self.assertEqual(
+                sorted(fm.getNodesBySolid(box.Solids[0])), [1, 2, 3, 4, 5, 6, 7, 8, 9, 12]
+            )
+            self.assertEqual(sorted(fm.getNodesByFace(bottom)), [1, 2, 3, 4])
+            self.assertEqual(sorted(fm.getNodesByFace(top)), [5, 6, 7, 8])
+            self.assertEqual(sorted(fm.getNodesByEdge(edge)), [1, 2])
+            self.assertEqual(sorted(fm.getNodesByVertex(vertex)), [1])
+            self.assertEqual(sorted(fm.getFacesByFace(bottom)), [1, 2])
+            self.assertEqual(sorted(fm.getFacesByFace(top)), [3, 4])
+            self.assertEqual(fm.getVolumesByFace(bottom), [(13, 1), (14, 2)])
+            self.assertEqual(fm.getVolumesByFace(top), [(15, 3), (16, 4)])
+            self.assertEqual(fm.getccxVolumesByFace(bottom), [(13, 1), (14, 4)])
+            self.assertEqual(fm.getccxVolumesByFace(top), [(15, 1), (16, 4)])
+
 
 # ************************************************************************************************
 # ************************************************************************************************
@@ -25,7 +25,10 @@
 #define WNT  // avoid conflict with GUID
 #endif
 #ifndef _PreComp_
+#include <Bnd_Box.hxx>
+#include <BRepBndLib.hxx>
 #include <Interface_Static.hxx>
+#include <Precision.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Version.hxx>
@@ -35,11 +38,14 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS_Iterator.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_GraphNode.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
 #endif
 
+#include <OSD_Parallel.hxx>
+
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 
@@ -51,9 +57,11 @@
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
 #include <Base/Parameter.h>
+#include <Base/Tools.h>
 #include <Mod/Part/App/FeatureCompound.h>
 #include <Mod/Part/App/Interface.h>
 #include <Mod/Part/App/OCAF/ImportExportSettings.h>
+#include <Mod/Part/App/TessellationCache.h>
 
 #include "ImportOCAF2.h"
 
@@ -293,82 +301,20 @@ bool ImportOCAF2::createObject(App::Document* doc,
     }
 
     getColor(shape, info);
-    bool hasFaceColors = false;
-    bool hasEdgeColors = false;
-
-    Part::TopoShape tshape(shape);
-    std::vector<App::Color> faceColors;
-    std::vector<App::Color> edgeColors;
-
-    TDF_LabelSequence seq;
-    if (!label.IsNull() && aShapeTool->GetSubShapes(label, seq)) {
-
-        TopTools_IndexedMapOfShape faceMap, edgeMap;
-        TopExp::MapShapes(tshape.getShape(), TopAbs_FACE, faceMap);
-        TopExp::MapShapes(tshape.getShape(), TopAbs_EDGE, edgeMap);
-
-        faceColors.assign(faceMap.Extent(), info.faceColor);
-        edgeColors.assign(edgeMap.Extent(), info.edgeColor);
-        // Two passes to get sub shape colors. First pass, look for solid, and
-        // second pass look for face and edges. This allows lower level
-        // subshape to override color of higher level ones.
-        for (int j = 0; j < 2; ++j) {
-            for (int i = 1; i <= seq.Length(); ++i) {
-                TDF_Label l = seq.Value(i);
-                TopoDS_Shape subShape = aShapeTool->GetShape(l);
-                if (subShape.IsNull()) {
-                    continue;
-                }
-                if (subShape.ShapeType() == TopAbs_FACE || subShape.ShapeType() == TopAbs_EDGE) {
-                    if (j == 0) {
-                        continue;
-                    }
-                }
-                else if (j != 0) {
-                    continue;
-                }
-
-                bool foundFaceColor = false, foundEdgeColor = false;
-                App::Color faceColor, edgeColor;
-                Quantity_ColorRGBA aColor;
-                if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
-                    || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
-                    faceColor = Tools::convertColor(aColor);
-                    foundFaceColor = true;
-                }
-                if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
-                    edgeColor = Tools::convertColor(aColor);
-                    foundEdgeColor = true;
-                    if (j == 0 && foundFaceColor && !faceColors.empty() && edgeColor == faceColor) {
-                        // Do not set edge the same color as face
-                        foundEdgeColor = false;
-                    }
-                }
 
-                if (foundFaceColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_FACE); exp.More(); exp.Next()) {
-                        int idx = faceMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)faceColors.size()) {
-                            faceColors[idx] = faceColor;
-                            hasFaceColors = true;
-                            info.hasFaceColor = true;
-                        }
-                    }
-                }
-                if (foundEdgeColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_EDGE); exp.More(); exp.Next()) {
-                        int idx = edgeMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)edgeColors.size()) {
-                            edgeColors[idx] = edgeColor;
-                            hasEdgeColors = true;
-                            info.hasEdgeColor = true;
-                        }
-                    }
-                }
-            }
-        }
+    ShapeColors colors;
+    auto it = myShapeColors.find(shape);
+    if (it != myShapeColors.end()) {
+        colors = std::move(it->second);
+        myShapeColors.erase(it);
+    }
+    else if (!label.IsNull()) {
+        mapSubShapeColors(shape, info, getSubShapeColors(label), colors);
     }
+    info.hasFaceColor = info.hasFaceColor || colors.hasFaceColors;
+    info.hasEdgeColor = info.hasEdgeColor || colors.hasEdgeColors;
 
+    Part::TopoShape tshape(shape);
     Part::Feature* feature;
 
     if (newDoc && (options.mode == ObjectPerDoc || options.mode == ObjectPerDir)) {
@@ -388,11 +334,11 @@ bool ImportOCAF2::createObject(App::Document* doc,
     }
     applyFaceColors(feature, {info.faceColor});
     applyEdgeColors(feature, {info.edgeColor});
-    if (hasFaceColors) {
-        applyFaceColors(feature, faceColors);
+    if (colors.hasFaceColors) {
+        applyFaceColors(feature, colors.faceColors);
     }
-    if (hasEdgeColors) {
-        applyEdgeColors(feature, edgeColors);
+    if (colors.hasEdgeColors) {
+        applyEdgeColors(feature, colors.edgeColors);
     }
 
     info.propPlacement = &feature->Placement;
@@ -502,6 +448,197 @@ bool ImportOCAF2::createGroup(App::Document* doc,
     return true;
 }
 
+std::vector<ImportOCAF2::SubShapeColor> ImportOCAF2::getSubShapeColors(TDF_Label label)
+{
+    std::vector<SubShapeColor> result;
+    TDF_LabelSequence seq;
+    if (label.IsNull() || !aShapeTool->GetSubShapes(label, seq)) {
+        return result;
+    }
+
+    for (int i = 1; i <= seq.Length(); ++i) {
+        TDF_Label l = seq.Value(i);
+        SubShapeColor sub;
+        sub.shape = aShapeTool->GetShape(l);
+        if (sub.shape.IsNull()) {
+            continue;
+        }
+
+        Quantity_ColorRGBA aColor;
+        if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
+            || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
+            sub.faceColor = Tools::convertColor(aColor);
+            sub.hasFaceColor = true;
+        }
+        if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
+            sub.edgeColor = Tools::convertColor(aColor);
+            sub.hasEdgeColor = true;
+        }
+        if (sub.hasFaceColor || sub.hasEdgeColor) {
+            result.push_back(sub);
+        }
+    }
+    return result;
+}
+
+void ImportOCAF2::mapSubShapeColors(const TopoDS_Shape& shape,
+                                    const Info& info,
+                                    const std::vector<SubShapeColor>& subShapeColors,
+                                    ShapeColors& colors)
+{
+    // Note: this function only works on the given shapes and doesn't access
+    // the OCAF document. Therefore it can be run concurrently for different shapes.
+    if (subShapeColors.empty()) {
+        return;
+    }
+
+    TopTools_IndexedMapOfShape faceMap, edgeMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+
+    colors.faceColors.assign(faceMap.Extent(), info.faceColor);
+    colors.edgeColors.assign(edgeMap.Extent(), info.edgeColor);
+    // Two passes to get sub shape colors. First pass, look for solid, and
+    // second pass look for face and edges. This allows lower level
+    // subshape to override color of higher level ones.
+    for (int j = 0; j < 2; ++j) {
+        for (const auto& sub : subShapeColors) {
+            const TopoDS_Shape& subShape = sub.shape;
+            if (subShape.ShapeType() == TopAbs_FACE || subShape.ShapeType() == TopAbs_EDGE) {
+                if (j == 0) {
+                    continue;
+                }
+            }
+            else if (j != 0) {
+                continue;
+            }
+
+            bool foundFaceColor = sub.hasFaceColor;
+            bool foundEdgeColor = sub.hasEdgeColor;
+            if (j == 0 && foundFaceColor && foundEdgeColor && !colors.faceColors.empty()
+                && sub.edgeColor == sub.faceColor) {
+                // Do not set edge the same color as face
+                foundEdgeColor = false;
+            }
+
+            if (foundFaceColor) {
+                for (TopExp_Explorer exp(subShape, TopAbs_FACE); exp.More(); exp.Next()) {
+                    int idx = faceMap.FindIndex(exp.Current()) - 1;
+                    if (idx >= 0 && idx < (int)colors.faceColors.size()) {
+                        colors.faceColors[idx] = sub.faceColor;
+                        colors.hasFaceColors = true;
+                    }
+                }
+            }
+            if (foundEdgeColor) {
+                for (TopExp_Explorer exp(subShape, TopAbs_EDGE); exp.More(); exp.Next()) {
+                    int idx = edgeMap.FindIndex(exp.Current()) - 1;
+                    if (idx >= 0 && idx < (int)colors.edgeColors.size()) {
+                        colors.edgeColors[idx] = sub.edgeColor;
+                        colors.hasEdgeColors = true;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ImportOCAF2::tessellate(const TopoDS_Shape& shape) const
+{
+    if (options.meshDeviation <= 0.0 || shape.IsNull()) {
+        return;
+    }
+
+    // Use the same deflection as the view provider so that it finds an
+    // adequate triangulation and doesn't have to mesh the shape again
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape, bounds);
+    if (bounds.IsVoid()) {
+        return;
+    }
+    bounds.SetGap(0.0);
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    double deflection =
+        ((xMax - xMin) + (yMax - yMin) + (zMax - zMin)) / 300.0 * options.meshDeviation;
+    if (deflection < gp::Resolution()) {
+        deflection = Precision::Confusion();
+    }
+    double angularDeflection = Base::toRadians(options.meshAngularDeflection);
+
+    Part::TessellationCache::instance().meshShape(shape,
+                                                  deflection,
+                                                  angularDeflection,
+                                                  /*allowQualityDecrease*/ true);
+}
+
+void ImportOCAF2::collectPrototypes(const TopoDS_Shape& shape,
+                                    std::vector<Prototype>& prototypes,
+                                    std::unordered_set<TopoDS_Shape, ShapeHasher>& visited)
+{
+    if (shape.IsNull()) {
+        return;
+    }
+
+    auto baseShape = shape.Located(TopLoc_Location());
+    if (!visited.insert(baseShape).second) {
+        return;
+    }
+
+    auto baseLabel = aShapeTool->FindShape(baseShape);
+    if (!baseLabel.IsNull() && aShapeTool->IsAssembly(baseLabel)) {
+        for (TopoDS_Iterator it(baseShape, Standard_False, Standard_False); it.More(); it.Next()) {
+            collectPrototypes(it.Value(), prototypes, visited);
+        }
+        return;
+    }
+
+    if (!TopExp_Explorer(baseShape, TopAbs_VERTEX).More()) {
+        return;
+    }
+
+    Prototype proto;
+    proto.label = baseLabel;
+    proto.shape = baseShape;
+    getColor(baseShape, proto.info);
+    proto.subShapeColors = getSubShapeColors(baseLabel);
+    prototypes.push_back(std::move(proto));
+}
+
+void ImportOCAF2::prepareShapes(const TDF_LabelSequence& labels)
+{
+    // All accesses to the OCAF document happen in this thread. Only the work on
+    // the unique (i.e. not instanced) shapes is distributed over several threads,
+    // the document objects are created afterwards in the usual order.
+    std::vector<Prototype> prototypes;
+    std::unordered_set<TopoDS_Shape, ShapeHasher> visited;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        auto label = labels.Value(i);
+        if (!options.importHidden && !aColorTool->IsVisible(label)) {
+            continue;
+        }
+        collectPrototypes(aShapeTool->GetShape(label), prototypes, visited);
+    }
+
+    FC_LOG("prepare " << prototypes.size() << " unique shapes");
+    OSD_Parallel::For(0, static_cast<int>(prototypes.size()), [this, &prototypes](int index) {
+        auto& proto = prototypes[index];
+        try {
+            mapSubShapeColors(proto.shape, proto.info, proto.subShapeColors, proto.colors);
+            tessellate(proto.shape);
+        }
+        catch (Standard_Failure&) {
+            // the failure will be reported when creating the object
+        }
+    });
+
+    for (auto& proto : prototypes) {
+        if (proto.colors.hasFaceColors || proto.colors.hasEdgeColors) {
+            myShapeColors.emplace(proto.shape, std::move(proto.colors));
+        }
+    }
+}
+
 App::DocumentObject* ImportOCAF2::loadShapes()
 {
     if (!options.useLinkGroup) {
@@ -523,11 +660,15 @@ App::DocumentObject* ImportOCAF2::loadShapes()
 
     labels.Clear();
     myShapes.clear();
+    myShapeColors.clear();
     myNames.clear();
     myCollapsedObjects.clear();
 
     std::vector<App::DocumentObject*> objs;
     aShapeTool->GetFreeShapes(labels);
+    if (options.parallel) {
+        prepareShapes(labels);
+    }
     boost::dynamic_bitset<> vis;
     int count = 0;
     for (Standard_Integer i = 1; i <= labels.Length(); i++) {
@@ -580,6 +721,7 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         ret = feature;
         ret->recomputeFeature(true);
     }
+    myShapeColors.clear();
     sequencer = nullptr;
     return ret;
 }
@@ -28,8 +28,11 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include <TDF_Label.hxx>
+#include <TDF_LabelSequence.hxx>
 #include <TDocStd_Document.hxx>
 #include <TopoDS_Shape.hxx>
 #include <XCAFDoc_ColorTool.hxx>
@@ -43,7 +46,6 @@
 #include "Tools.h"
 
 
-class TDF_Label;
 class TopLoc_Location;
 
 namespace App
@@ -71,7 +73,13 @@ struct ImportExport ImportOCAFOptions
     bool reduceObjects = false;
     bool showProgress = false;
     bool expandCompound = false;
+    bool parallel = true;
     int mode = 0;
+    /// Relative linear deflection used to tessellate the imported shapes
+    /// up front. Zero disables the tessellation.
+    double meshDeviation = 0.0;
+    /// Angular deflection in degree used together with meshDeviation
+    double meshAngularDeflection = 28.65;
 };
 
 class ImportExport ImportOCAF2
@@ -108,6 +116,17 @@ public:
     {
         options.expandCompound = enable;
     }
+    /// Prepare colors and tessellation of unique shapes concurrently
+    /// before the document objects are created
+    void setParallel(bool enable)
+    {
+        options.parallel = enable;
+    }
+    void setTessellation(double deviation, double angularDeflection)
+    {
+        options.meshDeviation = deviation;
+        options.meshAngularDeflection = angularDeflection;
+    }
 
     enum ImportMode
     {
@@ -137,6 +156,32 @@ private:
         int free = true;
     };
 
+    struct SubShapeColor
+    {
+        TopoDS_Shape shape;
+        App::Color faceColor;
+        App::Color edgeColor;
+        bool hasFaceColor = false;
+        bool hasEdgeColor = false;
+    };
+
+    struct ShapeColors
+    {
+        std::vector<App::Color> faceColors;
+        std::vector<App::Color> edgeColors;
+        bool hasFaceColors = false;
+        bool hasEdgeColors = false;
+    };
+
+    struct Prototype
+    {
+        TDF_Label label;
+        TopoDS_Shape shape;
+        Info info;
+        std::vector<SubShapeColor> subShapeColors;
+        ShapeColors colors;
+    };
+
     App::DocumentObject* loadShape(App::Document* doc,
                                    TDF_Label label,
                                    const TopoDS_Shape& shape,
@@ -163,6 +208,16 @@ private:
     getColor(const TopoDS_Shape& shape, Info& info, bool check = false, bool noDefault = false);
     void
     getSHUOColors(TDF_Label label, std::map<std::string, App::Color>& colors, bool appendFirst);
+    std::vector<SubShapeColor> getSubShapeColors(TDF_Label label);
+    static void mapSubShapeColors(const TopoDS_Shape& shape,
+                                  const Info& info,
+                                  const std::vector<SubShapeColor>& subShapeColors,
+                                  ShapeColors& colors);
+    void collectPrototypes(const TopoDS_Shape& shape,
+                           std::vector<Prototype>& prototypes,
+                           std::unordered_set<TopoDS_Shape, ShapeHasher>& visited);
+    void prepareShapes(const TDF_LabelSequence& labels);
+    void tessellate(const TopoDS_Shape& shape) const;
     void setObjectName(Info& info, TDF_Label label);
     std::string getLabelName(TDF_Label label);
     App::DocumentObject*
@@ -206,6 +261,7 @@ private:
     std::string filePath;
 
     std::unordered_map<TopoDS_Shape, Info, ShapeHasher> myShapes;
+    std::unordered_map<TopoDS_Shape, ShapeColors, ShapeHasher> myShapeColors;
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
 
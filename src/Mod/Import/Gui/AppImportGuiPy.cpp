@@ -244,6 +244,10 @@ private:
                         ocaf.setExpandCompound(
                             static_cast<bool>(Py::Boolean(options.getItem("expandCompound"))));
                     }
+                    if (options.hasKey("parallel")) {
+                        ocaf.setParallel(
+                            static_cast<bool>(Py::Boolean(options.getItem("parallel"))));
+                    }
                     if (options.hasKey("mode")) {
                         ocaf.setMode(static_cast<int>(Py::Long(options.getItem("mode"))));
                     }
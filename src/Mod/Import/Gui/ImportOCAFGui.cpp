@@ -26,6 +26,7 @@
 #include "PreCompiled.h"
 
 #include "ImportOCAFGui.h"
+#include <App/Application.h>
 #include <Gui/Application.h>
 #include <Gui/ViewProviderLink.h>
 #include <Mod/Part/Gui/ViewProvider.h>
@@ -38,6 +39,18 @@ ImportOCAFGui::ImportOCAFGui(Handle(TDocStd_Document) hDoc,
     : ImportOCAF2(hDoc, pDoc, name)
 {}
 
+Import::ImportOCAFOptions ImportOCAFGui::customImportOptions()
+{
+    Import::ImportOCAFOptions options = ImportOCAF2::customImportOptions();
+
+    // Same parameters as used by PartGui::ViewProviderPartExt::loadParameter()
+    ParameterGrp::handle hGrp =
+        App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part");
+    options.meshDeviation = hGrp->GetFloat("MeshDeviation", 0.2);
+    options.meshAngularDeflection = hGrp->GetFloat("MeshAngularDeflection", 28.65);
+    return options;
+}
+
 void ImportOCAFGui::applyFaceColors(Part::Feature* part, const std::vector<App::Color>& colors)
 {
     auto vp = dynamic_cast<PartGui::ViewProviderPartExt*>(
@@ -35,6 +35,10 @@ class ImportOCAFGui: public Import::ImportOCAF2
 public:
     ImportOCAFGui(Handle(TDocStd_Document) hDoc, App::Document* pDoc, const std::string& name);
 
+    /// Like ImportOCAF2::customImportOptions() but additionally pre-tessellates
+    /// the shapes with the settings of the Part view providers
+    static Import::ImportOCAFOptions customImportOptions();
+
 private:
     void applyFaceColors(Part::Feature* part, const std::vector<App::Color>& colors) override;
     void applyEdgeColors(Part::Feature* part, const std::vector<App::Color>& colors) override;
@@ -34,6 +34,7 @@
 #include <Base/Tools.h>
 #include <Mod/Mesh/App/Mesh.h>
 #include <Mod/Part/App/BRepMesh.h>
+#include <Mod/Part/App/TessellationCache.h>
 #include <Mod/Part/App/TopoShape.h>
 
 #include "Mesher.h"
@@ -225,6 +226,7 @@ Mesh::MeshObject* Mesher::createStandard() const
 {
     if (!shape.IsNull()) {
         BRepTools::Clean(shape);
+        Part::TessellationCache::instance().remove(shape);
         BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection);
     }
 
@@ -46,12 +46,14 @@
 
 // STL
 #include <array>
+#include <atomic>
 #include <fcntl.h>
 #include <fstream>
 #include <list>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
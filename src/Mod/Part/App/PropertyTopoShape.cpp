@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <iterator>
 # include <sstream>
 # include <Bnd_Box.hxx>
 # include <BRepBndLib.hxx>
@@ -339,9 +340,7 @@ void PropertyPartShape::Restore(Base::XMLReader &reader)
         }
     }
     else if (reader.hasAttribute(("binary")) && reader.getAttributeAsInteger("binary")) {
-        TopoShape shape;
-        shape.importBinary(reader.beginCharStream());
-        shape = shape.getShape();
+        shape.importBinary(reader.beginCharStream(Base::CharStreamFormat::Base64Encoded));
     }
     else if (reader.hasAttribute("brep") && reader.getAttributeAsInteger("brep")) {
         shape.importBrep(reader.beginCharStream(Base::CharStreamFormat::Raw));
@@ -559,6 +558,45 @@ void PropertyPartShape::loadFromStream(Base::Reader &reader)
     }
 }
 
+void PropertyPartShape::loadInParallel(Base::Reader &reader, bool binary)
+{
+    // Only copy the file content here, parsing the shape is what takes time
+    auto data = std::make_shared<std::string>(std::istreambuf_iterator<char>(reader),
+                                              std::istreambuf_iterator<char>());
+    auto shape = std::make_shared<TopoDS_Shape>();
+    auto failed = std::make_shared<bool>(false);
+    std::string fileName = reader.getFileName();
+
+    reader.addDecodeTask(
+        [data, shape, failed, binary]() {
+            if (data->empty()) {
+                return;
+            }
+            try {
+                std::istringstream str(*data);
+                if (binary) {
+                    TopoShape topoShape;
+                    topoShape.importBinary(str);
+                    *shape = topoShape.getShape();
+                }
+                else {
+                    BRep_Builder builder;
+                    BRepTools::Read(*shape, str, builder);
+                }
+            }
+            catch (...) {
+                *failed = true;
+            }
+        },
+        [this, shape, failed, fileName]() {
+            if (*failed) {
+                Base::Console().Warning("Failed to load BRep file %s\n", fileName.c_str());
+            }
+            // Keep the element map, its file may have been restored in the meantime
+            setValue(*shape, false);
+        });
+}
+
 void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
 {
     // If the shape is empty we simply store nothing. The file size will be 0 which
@@ -588,14 +626,17 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
 void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
 {
     Base::FileInfo brep(reader.getFileName());
-    if (brep.hasExtension("bin")) {
+    bool direct = App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
+    if (reader.canDecodeInParallel() && (direct || brep.hasExtension("bin"))) {
+        loadInParallel(reader, brep.hasExtension("bin"));
+    }
+    else if (brep.hasExtension("bin")) {
         TopoShape shape;
         shape.importBinary(reader);
         setValue(shape);
     }
     else {
-        bool direct = App::GetApplication().GetParameterGroupByPath
-            ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
         if (!direct) {
             loadFromFile(reader);
         }
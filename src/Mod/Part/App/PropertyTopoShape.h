@@ -110,6 +110,7 @@ private:
     void saveToFile(Base::Writer &writer) const;
     void loadFromFile(Base::Reader &reader);
     void loadFromStream(Base::Reader &reader);
+    void loadInParallel(Base::Reader &reader, bool binary);
 
 private:
     TopoShape _Shape;
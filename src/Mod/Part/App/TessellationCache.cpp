@@ -0,0 +1,340 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <cmath>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTools.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_Version.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#endif
+
+#include <OSD_Parallel.hxx>
+
+#include "TessellationCache.h"
+#include "ShapeMapHasher.h"
+#include "Tools.h"
+
+using namespace Part;
+
+namespace {
+Data::ComplexGeoData::Domain makeDomain(const TopoDS_Face& face)
+{
+    Data::ComplexGeoData::Domain domain;
+
+    std::vector<gp_Pnt> points;
+    std::vector<Poly_Triangle> facets;
+    if (!Tools::getTriangulation(face, points, facets)) {
+        return domain;
+    }
+
+    domain.points.reserve(points.size());
+    for (const auto& it : points) {
+        domain.points.emplace_back(it.X(), it.Y(), it.Z());
+    }
+
+    domain.facets.reserve(facets.size());
+    for (const auto& it : facets) {
+        Standard_Integer N1, N2, N3;
+        it.Get(N1, N2, N3);
+
+        Data::ComplexGeoData::Facet tria;
+        tria.I1 = N1;
+        tria.I2 = N2;
+        tria.I3 = N3;
+        domain.facets.push_back(tria);
+    }
+
+    return domain;
+}
+}
+
+std::size_t Tessellation::getMemSize() const
+{
+    std::size_t size = points.size() * sizeof(Base::Vector3d)
+        + facets.size() * sizeof(Data::ComplexGeoData::Facet);
+    for (const auto& it : domains) {
+        size += it.points.size() * sizeof(Base::Vector3d)
+            + it.facets.size() * sizeof(Data::ComplexGeoData::Facet);
+    }
+    for (const auto& it : segments) {
+        size += it.size() * sizeof(std::size_t);
+    }
+    return size;
+}
+
+// ----------------------------------------------------------------------------
+
+bool TessellationCache::Key::operator==(const Key& other) const
+{
+    return shape.IsEqual(other.shape)
+        && deflection == other.deflection
+        && angularDeflection == other.angularDeflection;
+}
+
+std::size_t TessellationCache::KeyHasher::operator()(const Key& key) const
+{
+    std::size_t seed = ShapeMapHasher{}(key.shape);
+    auto combine = [&seed](double value) {
+        // copied from boost::hash_combine
+        seed ^= std::hash<double>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    };
+    combine(key.deflection);
+    combine(key.angularDeflection);
+    return seed;
+}
+
+TessellationCache& TessellationCache::instance()
+{
+    static TessellationCache cache;
+    return cache;
+}
+
+void TessellationCache::extractDomains(const TopoDS_Shape& shape,
+                                       std::vector<Data::ComplexGeoData::Domain>& domains)
+{
+    std::vector<TopoDS_Face> faces;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        faces.push_back(TopoDS::Face(xp.Current()));
+    }
+
+    domains.clear();
+    domains.resize(faces.size());
+    // Reading the triangulation of a face doesn't modify the shape, so the faces
+    // can be processed independently of each other
+    OSD_Parallel::For(0, static_cast<int>(faces.size()), [&faces, &domains](int index) {
+        domains[index] = makeDomain(faces[index]);
+    });
+}
+
+bool TessellationCache::hasTriangulation(const TopoDS_Shape& shape, double deflection)
+{
+    TopLoc_Location loc;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        Handle(Poly_Triangulation) mesh =
+            BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+        if (mesh.IsNull()) {
+            return false;
+        }
+        // Another consumer may have re-meshed the face with different parameters.
+        // The tolerance is the one BRepMesh uses to accept an existing triangulation.
+        if (std::abs(mesh->Deflection() - deflection) > 0.1 * deflection) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TessellationPtr TessellationCache::createTessellation(const TopoDS_Shape& shape)
+{
+    auto tess = std::make_shared<Tessellation>();
+    extractDomains(shape, tess->domains);
+
+    BRepMesh mesh;
+    mesh.getFacesFromDomains(tess->domains, tess->points, tess->facets);
+    tess->segments = mesh.createSegments();
+    return tess;
+}
+
+void TessellationCache::meshShape(const TopoDS_Shape& shape,
+                                  double deflection,
+                                  double angularDeflection,
+                                  bool allowQualityDecrease)
+{
+    if (shape.IsNull()) {
+        return;
+    }
+
+    Key key{shape, deflection, angularDeflection};
+    bool meshed = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it != entries.end()) {
+            lruList.splice(lruList.begin(), lruList, it->second.lru);
+            meshed = true;
+        }
+    }
+
+    // BRepTools::Clean() or another mesher may have replaced the triangulation
+    // in the meantime
+    if (meshed && hasTriangulation(shape, deflection)) {
+        return;
+    }
+
+#if OCC_VERSION_HEX >= 0x070500
+    IMeshTools_Parameters meshParams;
+    meshParams.Deflection = deflection;
+    meshParams.Relative = Standard_False;
+    meshParams.Angle = angularDeflection;
+    meshParams.InParallel = Standard_True;
+    // a finer triangulation must be replaced to match the cached key
+    meshParams.AllowQualityDecrease = allowQualityDecrease || meshed;
+
+    BRepMesh_IncrementalMesh(shape, meshParams);
+#else
+    (void)allowQualityDecrease;
+    if (meshed) {
+        BRepTools::Clean(shape);
+    }
+    BRepMesh_IncrementalMesh(shape, deflection, Standard_False, angularDeflection, Standard_True);
+#endif
+
+    // Remember that the shape has been meshed but defer the extraction of the
+    // triangulation until somebody asks for it
+    insert(key, nullptr);
+}
+
+TessellationPtr TessellationCache::getTessellation(const TopoDS_Shape& shape,
+                                                   double deflection,
+                                                   double angularDeflection)
+{
+    if (shape.IsNull()) {
+        return std::make_shared<Tessellation>();
+    }
+
+    Key key{shape, deflection, angularDeflection};
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it != entries.end() && it->second.tessellation) {
+            lruList.splice(lruList.begin(), lruList, it->second.lru);
+            return it->second.tessellation;
+        }
+    }
+
+    // The lock is not held while meshing because this may take a long time.
+    // In the rare case that two threads tessellate the same shape the result
+    // of the last one is kept.
+    meshShape(shape, deflection, angularDeflection);
+    TessellationPtr tess = createTessellation(shape);
+    insert(key, tess);
+    return tess;
+}
+
+void TessellationCache::insert(const Key& key, const TessellationPtr& tess)
+{
+    std::size_t size = tess ? tess->getMemSize() : 0;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        if (tess) {
+            memSize = memSize - it->second.memSize + size;
+            it->second.tessellation = tess;
+            it->second.memSize = size;
+        }
+        lruList.splice(lruList.begin(), lruList, it->second.lru);
+        shrink();
+        return;
+    }
+
+    lruList.push_front(key);
+    entries.emplace(key, Entry{tess, lruList.begin(), size});
+    memSize += size;
+    shrink();
+}
+
+void TessellationCache::shrink()
+{
+    // the most recently used entry is kept even if it exceeds the memory limit alone
+    while (!lruList.empty()
+           && (entries.size() > maxEntries || (memSize > maxMemSize && entries.size() > 1))) {
+        erase(lruList.back());
+        lruList.pop_back();
+    }
+}
+
+void TessellationCache::erase(const Key& key)
+{
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        memSize -= it->second.memSize;
+        entries.erase(it);
+    }
+}
+
+void TessellationCache::remove(const TopoDS_Shape& shape)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = lruList.begin(); it != lruList.end();) {
+        if (it->shape.IsSame(shape)) {
+            erase(*it);
+            it = lruList.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void TessellationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    lruList.clear();
+    memSize = 0;
+}
+
+void TessellationCache::setMaxEntries(std::size_t num)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    maxEntries = num;
+    shrink();
+}
+
+std::size_t TessellationCache::getMaxEntries() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return maxEntries;
+}
+
+void TessellationCache::setMaxMemSize(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    maxMemSize = bytes;
+    shrink();
+}
+
+std::size_t TessellationCache::getMaxMemSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return maxMemSize;
+}
+
+std::size_t TessellationCache::getMemSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return memSize;
+}
+
+std::size_t TessellationCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2024 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef PART_TESSELLATIONCACHE_H
+#define PART_TESSELLATIONCACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+
+#include <App/ComplexGeoData.h>
+#include <Mod/Part/PartGlobal.h>
+
+#include "BRepMesh.h"
+
+namespace Part
+{
+
+/*!
+ * \brief The Tessellation struct
+ * Holds the triangulation of all faces of a shape for a given deflection.
+ */
+struct PartExport Tessellation
+{
+    /// Triangulation of each face in TopExp_Explorer order. A face that cannot be
+    /// meshed has an empty domain so that the numbers of faces and domains match.
+    std::vector<Data::ComplexGeoData::Domain> domains;
+    /// Merged vertices of all faces
+    std::vector<Base::Vector3d> points;
+    /// Triangles of all faces indexing into \a points
+    std::vector<Data::ComplexGeoData::Facet> facets;
+    /// Triangle indexes of \a facets per domain
+    std::vector<BRepMesh::Segment> segments;
+
+    std::size_t getMemSize() const;
+};
+
+using TessellationPtr = std::shared_ptr<const Tessellation>;
+
+/*!
+ * \brief The TessellationCache class
+ * Application wide cache of shape tessellations. An entry is keyed by the located
+ * shape and the linear and angular deflection, so that the view provider, mesh export
+ * and Python's Shape.tessellate() share one triangulation per deflection instead of
+ * computing it once per consumer.
+ *
+ * The cache keeps a reference to the shape of each entry, i.e. the key cannot be
+ * reused by a different shape while the entry is alive. The least recently used
+ * entries are dropped if either the number of entries or the memory used by the
+ * tessellations exceeds its limit.
+ */
+class PartExport TessellationCache
+{
+public:
+    static TessellationCache& instance();
+
+    /*!
+     * \brief getTessellation
+     * Returns the cached tessellation or meshes the shape and extracts the
+     * triangulation of its faces in parallel.
+     */
+    TessellationPtr getTessellation(const TopoDS_Shape& shape,
+                                    double deflection,
+                                    double angularDeflection);
+    /*!
+     * \brief meshShape
+     * Make sure that the shape carries a triangulation for the given parameters.
+     * The mesher is skipped if the shape has been meshed through the cache with
+     * the same parameters and all faces still have a triangulation of this deflection.
+     */
+    void meshShape(const TopoDS_Shape& shape,
+                   double deflection,
+                   double angularDeflection,
+                   bool allowQualityDecrease = false);
+    /*!
+     * \brief extractDomains
+     * Get the triangulation of all faces of an already meshed shape. The faces are
+     * processed in parallel.
+     */
+    static void extractDomains(const TopoDS_Shape& shape,
+                               std::vector<Data::ComplexGeoData::Domain>& domains);
+    /// Remove all entries of the given shape, e.g. after BRepTools::Clean()
+    void remove(const TopoDS_Shape& shape);
+    void clear();
+
+    void setMaxEntries(std::size_t num);
+    std::size_t getMaxEntries() const;
+    /// Set the maximum memory in bytes used by the cached tessellations
+    void setMaxMemSize(std::size_t bytes);
+    std::size_t getMaxMemSize() const;
+    std::size_t getMemSize() const;
+    std::size_t size() const;
+
+private:
+    TessellationCache() = default;
+
+    struct Key
+    {
+        TopoDS_Shape shape;
+        double deflection;
+        double angularDeflection;
+
+        bool operator==(const Key& other) const;
+    };
+    struct KeyHasher
+    {
+        std::size_t operator()(const Key& key) const;
+    };
+    using LruList = std::list<Key>;
+    struct Entry
+    {
+        TessellationPtr tessellation;
+        LruList::iterator lru;
+        std::size_t memSize;
+    };
+
+    static bool hasTriangulation(const TopoDS_Shape& shape, double deflection);
+    static TessellationPtr createTessellation(const TopoDS_Shape& shape);
+    void insert(const Key& key, const TessellationPtr& tess);
+    void shrink();
+    void erase(const Key& key);
+
+private:
+    mutable std::mutex mutex;
+    std::unordered_map<Key, Entry, KeyHasher> entries;
+    LruList lruList;
+    std::size_t maxEntries = 32;
+    std::size_t memSize = 0;
+    std::size_t maxMemSize = 256 * 1024 * 1024;
+};
+
+}  // namespace Part
+
+#endif  // PART_TESSELLATIONCACHE_H
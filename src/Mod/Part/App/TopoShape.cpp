@@ -181,6 +181,7 @@
 #include "modelRefine.h"
 #include "PartPyCXX.h"
 #include "ProgressIndicator.h"
+#include "TessellationCache.h"
 #include "Tools.h"
 #include "TopoShapeCompoundPy.h"
 #include "TopoShapeCompSolidPy.h"
@@ -998,11 +999,8 @@ void TopoShape::dump(std::ostream& out) const
 void TopoShape::exportStl(const char *filename, double deflection) const
 {
     StlAPI_Writer writer;
-    BRepMesh_IncrementalMesh aMesh(this->_Shape, deflection,
-                                   /*isRelative*/ Standard_False,
-                                   /*theAngDeflection*/
-                                   defaultAngularDeflection(deflection),
-                                   /*isInParallel*/ true);
+    TessellationCache::instance().meshShape(this->_Shape, deflection,
+                                            defaultAngularDeflection(deflection));
     writer.Write(this->_Shape,encodeFilename(filename).c_str());
 }
 
@@ -3260,50 +3258,10 @@ TopoDS_Shape TopoShape::removeSplitter() const
 
 void TopoShape::getDomains(std::vector<Domain>& domains) const
 {
-    std::size_t countFaces = 0;
-    for (TopExp_Explorer xp(this->_Shape, TopAbs_FACE); xp.More(); xp.Next()) {
-        ++countFaces;
-    }
-    domains.reserve(countFaces);
-
-    for (TopExp_Explorer xp(this->_Shape, TopAbs_FACE); xp.More(); xp.Next()) {
-        TopoDS_Face face = TopoDS::Face(xp.Current());
-
-        std::vector<gp_Pnt> points;
-        std::vector<Poly_Triangle> facets;
-        if (!Tools::getTriangulation(face, points, facets)) {
-            // For a face that cannot be meshed append an empty domain.
-            // It's important for some algorithms (e.g. color mapping) that the numbers of
-            // faces and domains match
-            Domain domain;
-            domains.push_back(domain);
-        }
-        else {
-            Domain domain;
-            // copy the points
-            domain.points.reserve(points.size());
-            for (const auto& it : points) {
-                Standard_Real X, Y, Z;
-                it.Coord (X, Y, Z);
-                domain.points.emplace_back(X, Y, Z);
-            }
-
-            // copy the triangles
-            domain.facets.reserve(facets.size());
-            for (const auto& it : facets) {
-                Standard_Integer N1, N2, N3;
-                it.Get(N1, N2, N3);
-
-                Facet tria;
-                tria.I1 = N1;
-                tria.I2 = N2;
-                tria.I3 = N3;
-                domain.facets.push_back(tria);
-            }
-
-            domains.push_back(domain);
-        }
-    }
+    // For a face that cannot be meshed an empty domain is appended.
+    // It's important for some algorithms (e.g. color mapping) that the numbers of
+    // faces and domains match
+    TessellationCache::extractDomains(this->_Shape, domains);
 }
 
 void TopoShape::getFacesFromDomains(const std::vector<Domain>& domains,
@@ -3331,14 +3289,10 @@ void TopoShape::getFaces(std::vector<Base::Vector3d> &aPoints,
         return;
 
     // get the meshes of all faces and then merge them
-    BRepMesh_IncrementalMesh aMesh(this->_Shape, accuracy,
-                                   /*isRelative*/ Standard_False,
-                                   /*theAngDeflection*/
-                                   defaultAngularDeflection(accuracy),
-                                   /*isInParallel*/ true);
-    std::vector<Domain> domains;
-    getDomains(domains);
-    getFacesFromDomains(domains, aPoints, aTopo);
+    TessellationPtr tess = TessellationCache::instance().getTessellation(
+        this->_Shape, accuracy, defaultAngularDeflection(accuracy));
+    aPoints = tess->points;
+    aTopo = tess->facets;
 }
 
 void TopoShape::setFaces(const std::vector<Base::Vector3d> &Points,
@@ -44,6 +44,8 @@
 #include <BRepTools_ReShape.hxx>
 #include <ShapeFix_Root.hxx>
 
+#include "ShapeMapHasher.h"
+
 class gp_Ax1;
 class gp_Ax2;
 class gp_Pln;
@@ -1637,6 +1639,11 @@ public:
      * @param op: optional string to be encoded into topo naming for indicating
      *            the operation
      *
+     * If deferred element mapping is enabled (see setElementMapDeferred()),
+     * only the shape history reported by the mapper is recorded, and the
+     * element map is generated on first access, e.g. when a mapped name is
+     * resolved or the shape is saved.
+     *
      * @return The original content of this TopoShape is discarded and replaced
      *         with the given new shape. The function returns the TopoShape
      *         itself as a self reference so that multiple operations can be
@@ -1646,6 +1653,9 @@ public:
                                        const Mapper &mapper,
                                        const std::vector<TopoShape> &sources,
                                        const char *op=nullptr);
+    /// Enable or disable deferred element map generation in makeShapeWithElementMap()
+    static void setElementMapDeferred(bool enable);
+    static bool isElementMapDeferred();
     /**
      * When given a single shape to create a compound, two results are possible: either to simply
      * return the shape as given, or to force it to be placed in a Compound.
@@ -2567,6 +2577,7 @@ public:
      */
 
     friend class TopoShapeCache;
+    friend struct MapperRecorded;
 
 private:
     // Cache storage
@@ -2755,6 +2766,34 @@ struct PartExport MapperHistory: TopoShape::Mapper
     const std::vector<TopoDS_Shape>& generated(const TopoDS_Shape& s) const override;
 };
 
+/** Shape mapper that replays a recorded shape history
+ *
+ * Used for deferred element map generation. The history of another mapper
+ * is queried for all sub-elements of the source shapes and stored, so that
+ * the element map can be generated after the shape maker is gone.
+ */
+struct PartExport MapperRecorded: TopoShape::Mapper
+{
+    MapperRecorded(const TopoShape::Mapper& mapper, const std::vector<TopoShape>& sources);
+    const std::vector<TopoDS_Shape>& modified(const TopoDS_Shape& s) const override;
+    const std::vector<TopoDS_Shape>& generated(const TopoDS_Shape& s) const override;
+
+private:
+    struct ShapeEqual
+    {
+        bool operator()(const TopoDS_Shape& a, const TopoDS_Shape& b) const
+        {
+            return a.IsEqual(b);
+        }
+    };
+    using HistoryMap = std::unordered_map<TopoDS_Shape,
+                                          std::vector<TopoDS_Shape>,
+                                          ShapeMapHasher,
+                                          ShapeEqual>;
+    HistoryMap modifiedShapes;
+    HistoryMap generatedShapes;
+};
+
 }  // namespace Part
 
 #endif  // PART_TOPOSHAPE_H
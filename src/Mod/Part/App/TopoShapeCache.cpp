@@ -152,6 +152,20 @@ int TopoShapeCache::Ancestry::count() const
 }
 
 
+PendingElementMap::PendingElementMap(const TopoShape::Mapper& mapper,
+                                     const std::vector<TopoShape>& sources,
+                                     const char* op,
+                                     long tag,
+                                     const App::StringHasherRef& hasher,
+                                     const TopLoc_Location& location)
+    : mapper(mapper, sources)
+    , sources(sources)
+    , op(op ? op : "")
+    , tag(tag)
+    , hasher(hasher)
+    , location(location)
+{}
+
 TopoShapeCache::TopoShapeCache(const TopoDS_Shape& tds)
     : shape(tds.Located(TopLoc_Location()))
 {}
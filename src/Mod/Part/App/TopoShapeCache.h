@@ -56,6 +56,26 @@ struct PartExport ShapeRelationKey
     bool operator<(const ShapeRelationKey& other) const;
 };
 
+/// Recorded shape history for deferred element map generation
+struct PartExport PendingElementMap
+{
+    PendingElementMap(const TopoShape::Mapper& mapper,
+                      const std::vector<TopoShape>& sources,
+                      const char* op,
+                      long tag,
+                      const App::StringHasherRef& hasher,
+                      const TopLoc_Location& location);
+
+    MapperRecorded mapper;
+    std::vector<TopoShape> sources;
+    std::string op;
+    long tag;
+    App::StringHasherRef hasher;
+    /// Location of the result shape when the history was recorded. The
+    /// recorded shapes only match the sub-shapes of the result at this location.
+    TopLoc_Location location;
+};
+
 class PartExport TopoShapeCache: public std::enable_shared_from_this<TopoShapeCache>
 {
 public:
@@ -66,6 +86,10 @@ public:
     /// generated.
     Data::ElementMapPtr cachedElementMap;
 
+    /// Shape history recorded in deferred mode. If set, the element map is
+    /// generated from it on the first call of TopoShape::flushElementMap().
+    std::shared_ptr<PendingElementMap> pendingElementMap;
+
     /// Location of the original cached TopoDS_Shape.
     TopLoc_Location subLocation;
 
@@ -25,6 +25,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <atomic>
 #include <cmath>
 
 #include <BRepAdaptor_Curve.hxx>
@@ -165,7 +166,24 @@ void TopoShape::flushElementMap() const
 {
     initCache();
     if (!elementMap(false) && this->_cache) {
-        if (this->_cache->cachedElementMap) {
+        if (this->_cache->pendingElementMap) {
+            // Take the recorded history out of the cache first, so that the
+            // replay below doesn't end up here again
+            auto pending = std::move(this->_cache->pendingElementMap);
+            // The shape may have been moved since, e.g. by setTransform(). Replay
+            // at the recorded location, so that the recorded history still matches
+            // the sub-shapes. The element map is indexed and so applies to the
+            // shape at its current location as well.
+            TopoDS_Shape shape = this->_Shape.Located(pending->location);
+            TopoShape self(pending->tag, pending->hasher, shape);
+            self._cache = _cache;
+            self.makeShapeWithElementMap(shape,
+                                         pending->mapper,
+                                         pending->sources,
+                                         pending->op.c_str());
+            const_cast<TopoShape*>(this)->resetElementMap(self.elementMap(false));
+        }
+        else if (this->_cache->cachedElementMap) {
             const_cast<TopoShape*>(this)->resetElementMap(this->_cache->cachedElementMap);
         }
         else if (this->_parentCache) {
@@ -715,7 +733,8 @@ std::vector<TopoDS_Shape> TopoShape::findAncestorsShapes(const TopoDS_Shape& sub
 bool TopoShape::hasPendingElementMap() const
 {
     return !elementMap(false) && this->_cache
-        && (this->_parentCache || this->_cache->cachedElementMap);
+        && (this->_parentCache || this->_cache->cachedElementMap
+            || this->_cache->pendingElementMap);
 }
 
 bool TopoShape::canMapElement(const TopoShape& other) const
@@ -885,6 +904,11 @@ void TopoShape::mapSubElement(const TopoShape& other, const char* op, bool force
         return;
     }
 
+    // Names are added to the existing map below, so it must not be pending
+    if (hasPendingElementMap()) {
+        flushElementMap();
+    }
+
     if (!getElementMapSize(false) && this->_Shape.IsPartner(other._Shape)) {
         if (!this->Hasher) {
             this->Hasher = other.Hasher;
@@ -1384,6 +1408,18 @@ void checkForParallelOrCoplanar(const TopoDS_Shape& newShape,
     }
 }
 
+static std::atomic<bool> elementMapDeferred {false};
+
+void TopoShape::setElementMapDeferred(bool enable)
+{
+    elementMapDeferred = enable;
+}
+
+bool TopoShape::isElementMapDeferred()
+{
+    return elementMapDeferred;
+}
+
 // TODO: Refactor makeShapeWithElementMap to reduce complexity
 TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                                               const Mapper& mapper,
@@ -1415,6 +1451,21 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
     if (!op) {
         op = Part::OpCodes::Maker;
     }
+
+    if (elementMapDeferred && !dynamic_cast<const MapperRecorded*>(&mapper)) {
+        // Use a cache of our own to not mix up the history with the element
+        // map of another shape sharing the same TShape
+        initCache(1);
+        _cache->pendingElementMap =
+            std::make_shared<PendingElementMap>(mapper,
+                                                shapes,
+                                                op,
+                                                Tag,
+                                                Hasher,
+                                                _Shape.Location());
+        return *this;
+    }
+
     std::string _op = op;
     _op += '_';
 
@@ -5335,6 +5386,57 @@ MapperHistory::MapperHistory(ShapeFix_Root& fix)
     }
 }
 
+MapperRecorded::MapperRecorded(const TopoShape::Mapper& mapper,
+                               const std::vector<TopoShape>& sources)
+{
+    // Query the history of the same sub-elements that makeShapeWithElementMap()
+    // asks for when generating the element map
+    static const std::array<TopAbs_ShapeEnum, 3> types = {TopAbs_VERTEX, TopAbs_EDGE, TopAbs_FACE};
+    for (const auto& source : sources) {
+        if (source.isNull()) {
+            continue;
+        }
+        source.initCache();
+        for (auto type : types) {
+            auto& ancestry = source._cache->getAncestry(type);
+            for (int i = 1; i <= ancestry.count(); i++) {
+                TopoDS_Shape element = ancestry.find(source._Shape, i);
+                if (modifiedShapes.count(element) || generatedShapes.count(element)) {
+                    continue;
+                }
+                const auto& modified = mapper.modified(element);
+                if (!modified.empty()) {
+                    modifiedShapes.emplace(element, modified);
+                }
+                const auto& generated = mapper.generated(element);
+                if (!generated.empty()) {
+                    generatedShapes.emplace(element, generated);
+                }
+            }
+        }
+    }
+}
+
+const std::vector<TopoDS_Shape>& MapperRecorded::modified(const TopoDS_Shape& s) const
+{
+    auto it = modifiedShapes.find(s);
+    if (it != modifiedShapes.end()) {
+        return it->second;
+    }
+    _res.clear();
+    return _res;
+}
+
+const std::vector<TopoDS_Shape>& MapperRecorded::generated(const TopoDS_Shape& s) const
+{
+    auto it = generatedShapes.find(s);
+    if (it != generatedShapes.end()) {
+        return it->second;
+    }
+    _res.clear();
+    return _res;
+}
+
 const std::vector<TopoDS_Shape>& MapperHistory::modified(const TopoDS_Shape& s) const
 {
     _res.clear();
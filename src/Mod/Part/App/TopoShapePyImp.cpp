@@ -96,6 +96,7 @@
 #include "OCCError.h"
 #include "PartPyCXX.h"
 #include "ShapeMapHasher.h"
+#include "TessellationCache.h"
 #include "TopoShapeMapper.h"
 
 
@@ -1542,8 +1543,10 @@ PyObject* TopoShapePy::tessellate(PyObject *args)
     try {
         std::vector<Base::Vector3d> Points;
         std::vector<Data::ComplexGeoData::Facet> Facets;
-        if (Base::asBoolean(ok))
+        if (Base::asBoolean(ok)) {
             BRepTools::Clean(getTopoShapePtr()->getShape());
+            TessellationCache::instance().remove(getTopoShapePtr()->getShape());
+        }
         getTopoShapePtr()->getFaces(Points, Facets,tolerance);
         Py::Tuple tuple(2);
         Py::List vertex;
@@ -1,7 +1,10 @@
 import FreeCAD as App
 import Part
 
+import os
+import tempfile
 import unittest
+import zipfile
 
 
 class TopoShapeAssertions:
@@ -80,6 +83,32 @@ class TopoShapeTest(unittest.TestCase, TopoShapeAssertions):
     def tearDown(self):
         App.closeDocument("TopoShape")
 
+    def testSaveRestoreBrep(self):
+        """Tests that shapes are saved and restored in the binary and the text BREP format"""
+        params = App.ParamGet("User parameter:BaseApp/Preferences/Document")
+        binary = params.GetBool("SaveBinaryBrep", True)
+        fileName = os.path.join(tempfile.gettempdir(), "TopoShapeBrep.FCStd")
+        try:
+            for mode, extension in ((True, ".bin"), (False, ".brp")):
+                params.SetBool("SaveBinaryBrep", mode)
+                doc = App.newDocument("TopoShapeBrep")
+                doc.addObject("Part::Feature", "Feature").Shape = self.box
+                doc.saveAs(fileName)
+                App.closeDocument(doc.Name)
+
+                with zipfile.ZipFile(fileName) as archive:
+                    self.assertIn("Feature.Shape" + extension, archive.namelist())
+
+                doc = App.openDocument(fileName)
+                shape = doc.Feature.Shape
+                App.closeDocument(doc.Name)
+                self.assertEqual(len(shape.Faces), 6)
+                self.assertAlmostEqual(shape.Volume, self.box.Volume)
+        finally:
+            params.SetBool("SaveBinaryBrep", binary)
+            if os.path.exists(fileName):
+                os.remove(fileName)
+
     def testTopoShapeBox(self):
         # Arrange our test TopoShape
         box2_toposhape = self.doc.Box2.Shape
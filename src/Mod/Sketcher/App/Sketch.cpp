@@ -79,6 +79,8 @@ Sketch::Sketch()
     , defaultSolver(GCS::DogLeg)
     , defaultSolverRedundant(GCS::DogLeg)
     , debugMode(GCS::Minimal)
+    , setUpReusable(false)
+    , setUpExtGeoCount(0)
 {}
 
 Sketch::~Sketch()
@@ -143,6 +145,9 @@ void Sketch::clear()
     Redundant.clear();
     PartiallyRedundant.clear();
     MalformedConstraints.clear();
+
+    setUpReusable = false;
+    setUpConstraints.clear();
 }
 
 bool Sketch::analyseBlockedGeometry(const std::vector<Part::Geometry*>& internalGeoList,
@@ -199,8 +204,6 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
 {
     Base::TimeElapsed start_time;
 
-    clear();
-
     std::vector<Part::Geometry*> intGeoList, extGeoList;
     for (int i = 0; i < int(GeoList.size()) - extGeoCount; i++) {
         intGeoList.push_back(GeoList[i]);
@@ -254,6 +257,60 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
     Base::Console().Log("\n");
 #endif  // DEBUG_BLOCK_CONSTRAINT
 
+    if (!doesBlockAffectOtherConstraints
+        && isSetUpReusable(GeoList, ConstraintList, extGeoCount, onlyBlockedGeometry)) {
+        reuseSetUp(GeoList, ConstraintList);
+    }
+    else {
+        buildSketch(intGeoList,
+                    extGeoList,
+                    ConstraintList,
+                    onlyBlockedGeometry,
+                    unenforceableConstraints,
+                    blockedGeoIds,
+                    doesBlockAffectOtherConstraints);
+
+        // Sketches with B-Splines need a second solve after OCCT updated the geometry and blocked
+        // geometry affected by other constraints is fixed depending on the diagnosis, so they
+        // are always set up from scratch
+        setUpReusable = !resolveAfterGeometryUpdated && !doesBlockAffectOtherConstraints;
+        setUpExtGeoCount = extGeoCount;
+        setUpOnlyBlockedGeometry = onlyBlockedGeometry;
+        setUpConstraints.clear();
+        setUpConstraints.reserve(ConstraintList.size());
+        for (auto constr : ConstraintList) {
+            setUpConstraints.emplace_back(constr->clone());
+        }
+    }
+
+    // Now we set the Sketch status with the latest solver information
+    GCSsys.getConflicting(Conflicting);
+    GCSsys.getRedundant(Redundant);
+    GCSsys.getPartiallyRedundant(PartiallyRedundant);
+    GCSsys.getDependentParams(pDependentParametersList);
+
+    calculateDependentParametersElements();
+
+    if (debugMode == GCS::Minimal || debugMode == GCS::IterationLevel) {
+        Base::TimeElapsed end_time;
+
+        Base::Console().Log("Sketcher::setUpSketch()-T:%s\n",
+                            Base::TimeElapsed::diffTime(start_time, end_time).c_str());
+    }
+
+    return GCSsys.dofsNumber();
+}
+
+void Sketch::buildSketch(const std::vector<Part::Geometry*>& intGeoList,
+                         const std::vector<Part::Geometry*>& extGeoList,
+                         const std::vector<Constraint*>& ConstraintList,
+                         const std::vector<bool>& onlyBlockedGeometry,
+                         const std::vector<bool>& unenforceableConstraints,
+                         std::vector<int>& blockedGeoIds,
+                         bool doesBlockAffectOtherConstraints)
+{
+    clear();
+
     buildInternalAlignmentGeometryMap(ConstraintList);
 
     addGeometry(intGeoList, onlyBlockedGeometry);
@@ -329,23 +386,90 @@ int Sketch::setUpSketch(const std::vector<Part::Geometry*>& GeoList,
         }
 #endif  // DEBUG_BLOCK_CONSTRAINT
     }
+}
 
-    // Now we set the Sketch status with the latest solver information
-    GCSsys.getConflicting(Conflicting);
-    GCSsys.getRedundant(Redundant);
-    GCSsys.getPartiallyRedundant(PartiallyRedundant);
-    GCSsys.getDependentParams(pDependentParametersList);
+bool Sketch::isSetUpReusable(const std::vector<Part::Geometry*>& GeoList,
+                             const std::vector<Constraint*>& ConstraintList,
+                             int extGeoCount,
+                             const std::vector<bool>& onlyBlockedGeometry) const
+{
+    if (!setUpReusable || extGeoCount != setUpExtGeoCount || GeoList.size() != Geoms.size()
+        || ConstraintList.size() != setUpConstraints.size()
+        || onlyBlockedGeometry != setUpOnlyBlockedGeometry) {
+        return false;
+    }
 
-    calculateDependentParametersElements();
+    // The solver parameters hold the geometry of the last solve, which must still be the
+    // geometry of the sketch
+    for (std::size_t i = 0; i < GeoList.size(); i++) {
+        if (!GeoList[i]->isSame(*Geoms[i].geo, 0.0, 0.0)) {
+            return false;
+        }
+    }
 
-    if (debugMode == GCS::Minimal || debugMode == GCS::IterationLevel) {
-        Base::TimeElapsed end_time;
+    std::size_t enforcedCount = 0;
+    for (std::size_t i = 0; i < ConstraintList.size(); i++) {
+        const Constraint* constr = ConstraintList[i];
+        const Constraint* old = setUpConstraints[i].get();
+        if (constr->Type != old->Type || constr->AlignmentType != old->AlignmentType
+            || constr->First != old->First || constr->FirstPos != old->FirstPos
+            || constr->Second != old->Second || constr->SecondPos != old->SecondPos
+            || constr->Third != old->Third || constr->ThirdPos != old->ThirdPos
+            || constr->isDriving != old->isDriving
+            || constr->InternalAlignmentIndex != old->InternalAlignmentIndex
+            || constr->isActive != old->isActive) {
+            return false;
+        }
 
-        Base::Console().Log("Sketcher::setUpSketch()-T:%s\n",
-                            Base::TimeElapsed::diffTime(start_time, end_time).c_str());
+        // Only datums are passed unchanged to the solver, other values (e.g. the angle of a
+        // tangency) are transformed when setting up the constraint
+        if (constr->getValue() != old->getValue()
+            && (!constr->isDimensional() || constr->Type == SnellsLaw)) {
+            return false;
+        }
+
+        if (constr->Type != Block && constr->isActive) {
+            enforcedCount++;
+        }
     }
 
-    return GCSsys.dofsNumber();
+    return enforcedCount == Constrs.size();
+}
+
+void Sketch::reuseSetUp(const std::vector<Part::Geometry*>& GeoList,
+                        const std::vector<Constraint*>& ConstraintList)
+{
+    // the geometry is the same, but may carry different extensions (e.g. construction mode)
+    for (std::size_t i = 0; i < GeoList.size(); i++) {
+        delete Geoms[i].geo;
+        Geoms[i].geo = GeoList[i]->clone();
+    }
+
+    // the order of the added constraints is the order of the enforced constraints in the list
+    auto constrDef = Constrs.begin();
+    for (std::size_t i = 0; i < ConstraintList.size(); i++) {
+        Constraint* constr = ConstraintList[i];
+        if (constr->Type == Block || !constr->isActive) {
+            continue;
+        }
+
+        constrDef->constr = constr;
+        if (constrDef->value && constr->isDimensional() && constr->Type != SnellsLaw) {
+            *constrDef->value = constr->getValue();
+        }
+        setUpConstraints[i]->setValue(constr->getValue());
+        ++constrDef;
+    }
+
+    isInitMove = false;
+    pDependencyGroups.clear();
+    clearTemporaryConstraints();
+    // some constraints scale their error by the size of the geometry
+    GCSsys.rescaleConstraints();
+    GCSsys.invalidatedDiagnosis();
+    GCSsys.declareUnknowns(Parameters);
+    GCSsys.declareDrivenParams(DrivenParameters);
+    GCSsys.initSolution(defaultSolverRedundant);
 }
 
 void Sketch::buildInternalAlignmentGeometryMap(const std::vector<Constraint*>& constraintList)
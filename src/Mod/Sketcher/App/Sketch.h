@@ -719,6 +719,12 @@ public:
 private:
     GCS::DebugMode debugMode;
 
+    // the state the solver was last set up with from scratch, see isSetUpReusable()
+    bool setUpReusable;
+    int setUpExtGeoCount;
+    std::vector<bool> setUpOnlyBlockedGeometry;
+    std::vector<std::unique_ptr<Constraint>> setUpConstraints;
+
 private:
     bool updateGeometry();
     void tryUpdateGeometry();
@@ -740,6 +746,25 @@ private:
 
     void buildInternalAlignmentGeometryMap(const std::vector<Constraint*>& constraintList);
 
+    /// sets up the geometry, constraints and solver from scratch
+    void buildSketch(const std::vector<Part::Geometry*>& intGeoList,
+                     const std::vector<Part::Geometry*>& extGeoList,
+                     const std::vector<Constraint*>& ConstraintList,
+                     const std::vector<bool>& onlyBlockedGeometry,
+                     const std::vector<bool>& unenforceableConstraints,
+                     std::vector<int>& blockedGeoIds,
+                     bool doesBlockAffectOtherConstraints);
+    /** checks whether the solver can be kept as set up by the last setUpSketch(), i.e. the
+     * geometry is the geometry of the last solve and the constraints only differ in datums
+     */
+    bool isSetUpReusable(const std::vector<Part::Geometry*>& GeoList,
+                         const std::vector<Constraint*>& ConstraintList,
+                         int extGeoCount,
+                         const std::vector<bool>& onlyBlockedGeometry) const;
+    /// updates the datums of the existing solver constraints and diagnoses the sketch again
+    void reuseSetUp(const std::vector<Part::Geometry*>& GeoList,
+                    const std::vector<Constraint*>& ConstraintList);
+
     int internalSolve(std::string& solvername, int level = 0);
 
     /// checks if the index bounds and converts negative indices to positive
@@ -47,10 +47,12 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cfloat>
 #include <future>
 #include <iostream>
 #include <limits>
+#include <thread>
 
 #include "GCS.h"
 #include "qp_eq.h"
@@ -481,6 +483,7 @@ System::System()
     , dogLegGaussStep(FullPivLU)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
+    , parallelSolveMinParams(200)
     , LM_eps(1E-10)
     , LM_eps1(1E-80)
     , LM_tau(1E-3)
@@ -1788,6 +1791,13 @@ void System::rescaleConstraint(int id, double coeff)
     }
 }
 
+void System::rescaleConstraints()
+{
+    for (auto constr : clist) {
+        constr->rescale();
+    }
+}
+
 void System::declareUnknowns(VEC_pD& params)
 {
     plist = params;
@@ -1976,24 +1986,57 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
         return Failed;
     }
 
-    bool isReset = false;
-    // return success by default in order to permit coincidence constraints to be applied
-    // even if no other system has to be solved
-    int res = Success;
+    std::vector<int> cids;
+    int paramsNum = 0;
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
-        if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
-            resetToReference();
-            isReset = true;
+        if (subSystems[cid] || subSystemsAux[cid]) {
+            cids.push_back(cid);
+            paramsNum += int(plists[cid].size());
         }
+    }
+    if (!cids.empty()) {
+        resetToReference();
+    }
+
+    auto solveComponent = [&](int cid) {
         if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res,
-                           solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+            return solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
         }
         else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+            return solve(subSystems[cid], isFine, alg, isRedundantsolving);
+        }
+        return solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
+    };
+
+    // return success by default in order to permit coincidence constraints to be applied
+    // even if no other system has to be solved
+    int res = Success;
+    std::size_t threadsNum = std::min<std::size_t>(cids.size(), std::thread::hardware_concurrency());
+    if (threadsNum > 1 && paramsNum >= parallelSolveMinParams && debugMode != IterationLevel) {
+        // The decoupled components share neither constraints nor unknowns and every
+        // subsystem solves on its own copy of the parameters, so they can be solved
+        // concurrently. Each thread picks the next unsolved component.
+        std::atomic<std::size_t> next {0};
+        auto worker = [&]() {
+            int workerRes = Success;
+            for (std::size_t i = next++; i < cids.size(); i = next++) {
+                workerRes = std::max(workerRes, solveComponent(cids[i]));
+            }
+            return workerRes;
+        };
+        std::vector<std::future<int>> futures;
+        futures.reserve(threadsNum - 1);
+        for (std::size_t i = 1; i < threadsNum; i++) {
+            futures.push_back(std::async(std::launch::async, worker));
+        }
+        res = std::max(res, worker());
+        for (auto& fut : futures) {
+            res = std::max(res, fut.get());
         }
-        else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+    }
+    else {
+        for (int cid : cids) {
+            res = std::max(res, solveComponent(cid));
         }
     }
     if (res == Success) {
@@ -2336,6 +2379,50 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
     return (stop == 1) ? Success : Failed;
 }
 
+int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
+{
+    if (dogLegGaussStep == LeastNormSparseLdlt) {
+        return solve_DL<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+    return solve_DL<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+void System::calcGaussStep(SubSystem* /*subsys*/,
+                           const Eigen::MatrixXd& Jx,
+                           const Eigen::VectorXd& fx,
+                           Eigen::VectorXd& h_gn)
+{
+    // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
+    // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+    switch (dogLegGaussStep) {
+        case FullPivLU:
+            h_gn = Jx.fullPivLu().solve(-fx);
+            break;
+        case LeastNormFullPivLU:
+            h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
+            break;
+        case LeastNormLdlt:
+        case LeastNormSparseLdlt:
+            h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
+            break;
+    }
+}
+
+void System::calcGaussStep(SubSystem* subsys,
+                           const Eigen::SparseMatrix<double>& Jx,
+                           const Eigen::VectorXd& fx,
+                           Eigen::VectorXd& h_gn)
+{
+    // the same as LeastNormLdlt but J*J^T is factorized as sparse matrix, whose
+    // symbolic analysis is kept by the subsystem
+    if (!subsys->solveLeastNorm(Jx, -fx, h_gn)) {
+        // J*J^T is singular, e.g. because of redundant constraints
+        Eigen::MatrixXd J(Jx);
+        h_gn = J.adjoint() * (J * J.adjoint()).fullPivLu().solve(-fx);
+    }
+}
+
+template<typename Jacobian>
 int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
@@ -2370,8 +2457,10 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
                << ", dogLegGaussStep: "
                << (dogLegGaussStep == FullPivLU
                        ? "FullPivLU"
-                       : (dogLegGaussStep == LeastNormFullPivLU ? "LeastNormFullPivLU"
-                                                                : "LeastNormLdlt"))
+                       : (dogLegGaussStep == LeastNormFullPivLU
+                              ? "LeastNormFullPivLU"
+                              : (dogLegGaussStep == LeastNormLdlt ? "LeastNormLdlt"
+                                                                  : "LeastNormSparseLdlt")))
                << ", xsize: " << xsize << ", csize: " << csize << ", maxIter: " << maxIterNumber
                << "\n";
 
@@ -2381,7 +2470,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    Jacobian Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
     subsys->redirectParams();
@@ -2433,19 +2522,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         h_sd = alpha * g;
 
         // get the gauss-newton step
-        // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
-        // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-        switch (dogLegGaussStep) {
-            case FullPivLU:
-                h_gn = Jx.fullPivLu().solve(-fx);
-                break;
-            case LeastNormFullPivLU:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                break;
-            case LeastNormLdlt:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                break;
-        }
+        calcGaussStep(subsys, Jx, fx, h_gn);
 
         double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
         if (rel_error > 1e15) {
@@ -4885,10 +4962,11 @@ void System::makeReducedJacobian(Eigen::MatrixXd& J,
                                  std::map<int, int>& tagmultiplicity)
 {
     // construct specific parameter list for diagonose ignoring driven constraint parameters
+    std::set<double*> drivenParams(pdrivenlist.begin(), pdrivenlist.end());
+    MAP_pD_I diagnoseIndex;
     for (int j = 0; j < int(plist.size()); j++) {
-        auto result1 = std::find(std::begin(pdrivenlist), std::end(pdrivenlist), plist[j]);
-
-        if (result1 == std::end(pdrivenlist)) {
+        if (drivenParams.count(plist[j]) == 0) {
+            diagnoseIndex[plist[j]] = pdiagnoselist.size();
             pdiagnoselist.push_back(plist[j]);
         }
     }
@@ -4904,8 +4982,12 @@ void System::makeReducedJacobian(Eigen::MatrixXd& J,
         ++allcount;
         if ((*constr)->getTag() >= 0 && (*constr)->isDriving()) {
             jacobianconstraintcount++;
-            for (int j = 0; j < int(pdiagnoselist.size()); j++) {
-                J(jacobianconstraintcount - 1, j) = (*constr)->grad(pdiagnoselist[j]);
+            // the gradient with respect to any other parameter is zero
+            for (const auto param : c2p[*constr]) {
+                auto it = diagnoseIndex.find(param);
+                if (it != diagnoseIndex.end()) {
+                    J(jacobianconstraintcount - 1, it->second) = (*constr)->grad(param);
+                }
             }
 
             // parallel processing: create tag multiplicity map
@@ -5059,37 +5141,200 @@ int System::diagnose(Algorithm alg)
     // From here on, presuming `J.rows() > 0`.
     emptyDiagnoseMatrix = false;
 
-    if (qrAlgorithm == EigenDenseQR) {
 #ifdef PROFILE_DIAGNOSE
-        Base::TimeElapsed DenseQR_start_time;
+    Base::TimeElapsed Diagnose_start_time;
+#endif
+
+    int constrNum = jacobianconstraintmap.size();
+    int paramsNum = pdiagnoselist.size();
+
+    // The reduced Jacobian is block diagonal (up to permutations) with one block per group of
+    // constraints that share parameters. The rank is the sum of the ranks of the blocks and any
+    // conflicting group of constraints or dependent group of parameters is contained in a
+    // single block. So the blocks are decomposed independently, which is cheaper than a single
+    // QR decomposition of the whole matrix, and blocks that did not change since the last
+    // diagnosis, e.g. because a constraint was added to a different part of the sketch, are not
+    // decomposed again.
+    Graph g;
+    for (int i = 0; i < constrNum + paramsNum; i++) {
+        boost::add_vertex(g);
+    }
+    for (int i = 0; i < constrNum; i++) {
+        for (int j = 0; j < paramsNum; j++) {
+            if (J(i, j) != 0) {
+                boost::add_edge(i, constrNum + j, g);
+            }
+        }
+    }
+
+    VEC_I components(boost::num_vertices(g));
+    int componentsSize = boost::connected_components(g, &components[0]);
+
+    std::vector<std::vector<int>> blockRows(componentsSize), blockCols(componentsSize);
+    for (int i = 0; i < constrNum; i++) {
+        blockRows[components[i]].push_back(i);
+    }
+    for (int j = 0; j < paramsNum; j++) {
+        blockCols[components[constrNum + j]].push_back(j);
+    }
+
+    std::unordered_multimap<std::size_t, DiagnosedBlock> blocks;
+    int rank = 0;
+    std::vector<std::vector<Constraint*>> conflictGroups;
+    pDependentParameters.clear();
+    pDependentParametersGroups.clear();
+    for (int cid = 0; cid < componentsSize; cid++) {
+        const auto& rows = blockRows[cid];
+        const auto& cols = blockCols[cid];
+
+        DiagnosedBlock block;
+        block.J.resize(rows.size(), cols.size());
+        for (std::size_t i = 0; i < rows.size(); i++) {
+            for (std::size_t j = 0; j < cols.size(); j++) {
+                block.J(i, j) = J(rows[i], cols[j]);
+            }
+        }
+        block.qrAlgorithm = qrAlgorithm;
+        block.qrpivotThreshold = qrpivotThreshold;
+
+        std::size_t hash = block.hash();
+        auto range = diagnosedBlocks.equal_range(hash);
+        auto cached = std::find_if(range.first, range.second, [&block](const auto& item) {
+            return item.second.isSameInput(block);
+        });
+        if (cached != range.second) {
+            block = cached->second;
+        }
+        else {
+            diagnoseBlock(block);
+        }
+
+        rank += block.rank;
+        for (const auto& group : block.conflictGroups) {
+            std::vector<Constraint*> constrs;
+            for (int row : group) {
+                constrs.push_back(clist[jacobianconstraintmap.at(rows[row])]);
+            }
+            conflictGroups.push_back(std::move(constrs));
+        }
+        for (const auto& group : block.dependentParameterGroups) {
+            VEC_pD params;
+            for (int col : group) {
+                params.push_back(pdiagnoselist[cols[col]]);
+            }
+            pDependentParameters.insert(pDependentParameters.end(), params.begin(), params.end());
+            pDependentParametersGroups.push_back(std::move(params));
+        }
+
+        blocks.emplace(hash, std::move(block));
+    }
+    diagnosedBlocks = std::move(blocks);
+
+#ifdef _GCS_DEBUG
+    SolverReportingManager::Manager().LogGroupOfParameters("ParameterGroups",
+                                                           pDependentParametersGroups);
+#endif
+
+    dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
+
+    // Detecting conflicting or redundant constraints
+    if (constrNum > rank) {
+        // conflicting or redundant constraints
+        int nonredundantconstrNum;
+        identifyConflictingRedundantConstraints(alg,
+                                                conflictGroups,
+                                                tagmultiplicity,
+                                                pdiagnoselist,
+                                                constrNum,
+                                                nonredundantconstrNum);
+        if (paramsNum == rank && nonredundantconstrNum > rank) {  // over-constrained
+            dofs = paramsNum - nonredundantconstrNum;
+        }
+    }
+
+#ifdef PROFILE_DIAGNOSE
+    Base::TimeElapsed Diagnose_end_time;
+
+    auto SolveTime = Base::TimeElapsed::diffTimeF(Diagnose_start_time, Diagnose_end_time);
+
+    Base::Console().Log("\nDiagnose - Lapsed Time: %f seconds\n", SolveTime);
 #endif
 
-        int rank = 0;  // rank is not cheap to retrieve from qrJT in DenseQR
+    return dofs;
+}
+
+std::size_t System::DiagnosedBlock::hash() const
+{
+    std::size_t seed = std::hash<int>()(qrAlgorithm);
+    auto combine = [&seed](std::size_t value) {
+        // copied from boost::hash_combine
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    };
+    combine(std::hash<double>()(qrpivotThreshold));
+    combine(std::hash<Eigen::Index>()(J.rows()));
+    combine(std::hash<Eigen::Index>()(J.cols()));
+    for (Eigen::Index i = 0; i < J.size(); i++) {
+        combine(std::hash<double>()(J.data()[i]));
+    }
+    return seed;
+}
+
+bool System::DiagnosedBlock::isSameInput(const DiagnosedBlock& other) const
+{
+    return qrAlgorithm == other.qrAlgorithm && qrpivotThreshold == other.qrpivotThreshold
+        && J.rows() == other.J.rows() && J.cols() == other.J.cols() && J == other.J;
+}
+
+void System::diagnoseBlock(DiagnosedBlock& block)
+{
+    int constrNum = block.J.rows();
+    int paramsNum = block.J.cols();
+
+    block.rank = 0;
+    block.conflictGroups.clear();
+    block.dependentParameterGroups.clear();
+
+    // A constraint without any parameter to diagnose can only be redundant or conflicting on
+    // its own, and a parameter not used by any constraint is free.
+    if (paramsNum == 0) {
+        for (int i = 0; i < constrNum; i++) {
+            block.conflictGroups.push_back({i});
+        }
+        return;
+    }
+    if (constrNum == 0) {
+        for (int j = 0; j < paramsNum; j++) {
+            block.dependentParameterGroups.push_back({j});
+        }
+        return;
+    }
+
+    // the rows of the block are the rows of the matrix to decompose
+    std::map<int, int> jacobianconstraintmap;
+    for (int i = 0; i < constrNum; i++) {
+        jacobianconstraintmap[i] = i;
+    }
+
+    if (block.qrAlgorithm == EigenDenseQR) {
         Eigen::MatrixXd R;
         Eigen::FullPivHouseholderQR<Eigen::MatrixXd> qrJT;
         // Here we give the system the possibility to run the two QR decompositions in parallel,
         // depending on the load of the system so we are using the default std::launch::async |
         // std::launch::deferred policy, as nobody better than the system nows if it can run the
-        // task in parallel or is oversubscribed and should deferred it. Care to wait() for the
-        // future before any prospective detection of conflicting/redundant, because the
-        // redundant solve modifies pdiagnoselist and it would NOT be thread-safe. Care to call
-        // the thread with silent=true, unless the present thread does not use Base::Console, or
-        // the launch policy is set to std::launch::deferred policy, as it is not thread-safe to
-        // use them in both at the same time.
+        // task in parallel or is oversubscribed and should deferred it. Care to call the thread
+        // with silent=true, unless the present thread does not use Base::Console, or the launch
+        // policy is set to std::launch::deferred policy, as it is not thread-safe to use them in
+        // both at the same time.
         //
-        // identifyDependentParametersDenseQR(J, jacobianconstraintmap, pdiagnoselist, true)
+        // identifyDependentParametersDenseQR(J, jacobianconstraintmap, true)
         //
         auto fut = std::async(&System::identifyDependentParametersDenseQR,
                               this,
-                              J,
+                              block.J,
                               jacobianconstraintmap,
-                              pdiagnoselist,
                               true);
 
-        makeDenseQRDecomposition(J, jacobianconstraintmap, qrJT, rank, R);
-
-        int paramsNum = qrJT.rows();
-        int constrNum = qrJT.cols();
+        makeDenseQRDecomposition(block.J, jacobianconstraintmap, qrJT, block.rank, R);
 
         // This function is legacy code that was used to obtain partial geometry dependency
         // information from a SINGLE Dense QR decomposition. I am reluctant to remove it from
@@ -5097,114 +5342,43 @@ int System::diagnose(Algorithm alg)
         // identifyDependentGeometryParametersInTransposedJacobianDenseQRDecomposition( qrJT,
         // pdiagnoselist, paramsNum, rank);
 
-        fut.wait();  // wait for the execution of identifyDependentParametersSparseQR to finish
-
-        dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
-
-        // Detecting conflicting or redundant constraints
-        if (constrNum > rank) {
-            // conflicting or redundant constraints
-            int nonredundantconstrNum;
-            identifyConflictingRedundantConstraints(alg,
-                                                    qrJT,
-                                                    jacobianconstraintmap,
-                                                    tagmultiplicity,
-                                                    pdiagnoselist,
-                                                    R,
-                                                    constrNum,
-                                                    rank,
-                                                    nonredundantconstrNum);
-            if (paramsNum == rank && nonredundantconstrNum > rank) {  // over-constrained
-                dofs = paramsNum - nonredundantconstrNum;
-            }
+        if (constrNum > block.rank) {
+            identifyConflictGroups(qrJT, R, block.rank, block.conflictGroups);
         }
 
-#ifdef PROFILE_DIAGNOSE
-        Base::TimeElapsed DenseQR_end_time;
-
-        auto SolveTime = Base::TimeElapsed::diffTimeF(DenseQR_start_time, DenseQR_end_time);
-
-        Base::Console().Log("\nDenseQR - Lapsed Time: %f seconds\n", SolveTime);
-#endif
+        block.dependentParameterGroups = fut.get();
     }
-
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
-    else if (qrAlgorithm == EigenSparseQR) {
-#ifdef PROFILE_DIAGNOSE
-        Base::TimeElapsed SparseQR_start_time;
-#endif
-        int rank = 0;
+    else if (block.qrAlgorithm == EigenSparseQR) {
         Eigen::MatrixXd R;
         Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> SqrJT;
-        // Here we give the system the possibility to run the two QR decompositions in parallel,
-        // depending on the load of the system so we are using the default std::launch::async |
-        // std::launch::deferred policy, as nobody better than the system nows if it can run the
-        // task in parallel or is oversubscribed and should deferred it. Care to wait() for the
-        // future before any prospective detection of conflicting/redundant, because the
-        // redundant solve modifies pdiagnoselist and it would NOT be thread-safe. Care to call
-        // the thread with silent=true, unless the present thread does not use Base::Console, or
-        // the launch policy is set to std::launch::deferred policy, as it is not thread-safe to
-        // use them in both at the same time.
-        //
-        // identifyDependentParametersSparseQR(J, jacobianconstraintmap, pdiagnoselist, true)
+        // See above regarding running the two QR decompositions in parallel.
         //
         // Debug:
         // auto fut =
         // std::async(std::launch::deferred,&System::identifyDependentParametersSparseQR, this,
-        // J, jacobianconstraintmap, pdiagnoselist, false);
+        // J, jacobianconstraintmap, false);
         auto fut = std::async(&System::identifyDependentParametersSparseQR,
                               this,
-                              J,
+                              block.J,
                               jacobianconstraintmap,
-                              pdiagnoselist,
                               /*silent=*/true);
 
-        makeSparseQRDecomposition(J,
+        makeSparseQRDecomposition(block.J,
                                   jacobianconstraintmap,
                                   SqrJT,
-                                  rank,
+                                  block.rank,
                                   R,
                                   /*transposed=*/true,
                                   /*silent=*/false);
 
-        int paramsNum = SqrJT.rows();
-        int constrNum = SqrJT.cols();
-
-        fut.wait();  // wait for the execution of identifyDependentParametersSparseQR to finish
-
-        dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
-
-        // Detecting conflicting or redundant constraints
-        if (constrNum > rank) {
-            int nonredundantconstrNum;
-
-            identifyConflictingRedundantConstraints(alg,
-                                                    SqrJT,
-                                                    jacobianconstraintmap,
-                                                    tagmultiplicity,
-                                                    pdiagnoselist,
-                                                    R,
-                                                    constrNum,
-                                                    rank,
-                                                    nonredundantconstrNum);
-
-            if (paramsNum == rank && nonredundantconstrNum > rank) {
-                // over-constrained
-                dofs = paramsNum - nonredundantconstrNum;
-            }
+        if (constrNum > block.rank) {
+            identifyConflictGroups(SqrJT, R, block.rank, block.conflictGroups);
         }
 
-#ifdef PROFILE_DIAGNOSE
-        Base::TimeElapsed SparseQR_end_time;
-
-        auto SolveTime = Base::TimeElapsed::diffTimeF(SparseQR_start_time, SparseQR_end_time);
-
-        Base::Console().Log("\nSparseQR - Lapsed Time: %f seconds\n", SolveTime);
-#endif
+        block.dependentParameterGroups = fut.get();
     }
 #endif
-
-    return dofs;
 }
 
 void System::makeDenseQRDecomposition(const Eigen::MatrixXd& J,
@@ -5381,10 +5555,10 @@ void System::makeSparseQRDecomposition(
 }
 #endif  // EIGEN_SPARSEQR_COMPATIBLE
 
-void System::identifyDependentParametersDenseQR(const Eigen::MatrixXd& J,
-                                                const std::map<int, int>& jacobianconstraintmap,
-                                                const GCS::VEC_pD& pdiagnoselist,
-                                                bool silent)
+std::vector<std::vector<int>>
+System::identifyDependentParametersDenseQR(const Eigen::MatrixXd& J,
+                                           const std::map<int, int>& jacobianconstraintmap,
+                                           bool silent)
 {
     Eigen::FullPivHouseholderQR<Eigen::MatrixXd> qrJ;
     Eigen::MatrixXd Rparams;
@@ -5393,14 +5567,16 @@ void System::identifyDependentParametersDenseQR(const Eigen::MatrixXd& J,
 
     makeDenseQRDecomposition(J, jacobianconstraintmap, qrJ, rank, Rparams, false, true);
 
-    identifyDependentParameters(qrJ, Rparams, rank, pdiagnoselist, silent);
+    std::vector<std::vector<int>> groups;
+    identifyDependentParameters(qrJ, Rparams, rank, groups, silent);
+    return groups;
 }
 
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
-void System::identifyDependentParametersSparseQR(const Eigen::MatrixXd& J,
-                                                 const std::map<int, int>& jacobianconstraintmap,
-                                                 const GCS::VEC_pD& pdiagnoselist,
-                                                 bool silent)
+std::vector<std::vector<int>>
+System::identifyDependentParametersSparseQR(const Eigen::MatrixXd& J,
+                                            const std::map<int, int>& jacobianconstraintmap,
+                                            bool silent)
 {
     Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> SqrJ;
     Eigen::MatrixXd Rparams;
@@ -5415,7 +5591,9 @@ void System::identifyDependentParametersSparseQR(const Eigen::MatrixXd& J,
                               false,
                               true);  // do not transpose allow one to diagnose parameters
 
-    identifyDependentParameters(SqrJ, Rparams, nontransprank, pdiagnoselist, silent);
+    std::vector<std::vector<int>> groups;
+    identifyDependentParameters(SqrJ, Rparams, nontransprank, groups, silent);
+    return groups;
 }
 #endif
 
@@ -5423,7 +5601,7 @@ template<typename T>
 void System::identifyDependentParameters(T& qrJ,
                                          Eigen::MatrixXd& Rparams,
                                          int rank,
-                                         const GCS::VEC_pD& pdiagnoselist,
+                                         std::vector<std::vector<int>>& groups,
                                          bool silent)
 {
     (void)silent;  // silent is only used in debug code, but it is important as Base::Console is not
@@ -5440,29 +5618,24 @@ void System::identifyDependentParameters(T& qrJ,
     }
 #endif
 
-    pDependentParametersGroups.resize(qrJ.cols() - rank);
+    groups.resize(qrJ.cols() - rank);
     for (int j = rank; j < qrJ.cols(); j++) {
         for (int row = 0; row < rank; row++) {
             if (fabs(Rparams(row, j)) > 1e-10) {
                 int origCol = qrJ.colsPermutation().indices()[row];
 
-                pDependentParametersGroups[j - rank].push_back(pdiagnoselist[origCol]);
-                pDependentParameters.push_back(pdiagnoselist[origCol]);
+                groups[j - rank].push_back(origCol);
             }
         }
         int origCol = qrJ.colsPermutation().indices()[j];
 
-        pDependentParametersGroups[j - rank].push_back(pdiagnoselist[origCol]);
-        pDependentParameters.push_back(pdiagnoselist[origCol]);
+        groups[j - rank].push_back(origCol);
     }
 
 #ifdef _GCS_DEBUG
     if (!silent) {
         SolverReportingManager::Manager().LogMatrix("PermMatrix",
                                                     (Eigen::MatrixXd)qrJ.colsPermutation());
-
-        SolverReportingManager::Manager().LogGroupOfParameters("ParameterGroups",
-                                                               pDependentParametersGroups);
     }
 
 #endif
@@ -5574,33 +5747,37 @@ void System::eliminateNonZerosOverPivotInUpperTriangularMatrix(Eigen::MatrixXd&
 }
 
 template<typename T>
-void System::identifyConflictingRedundantConstraints(
-    Algorithm alg,
-    const T& qrJT,
-    const std::map<int, int>& jacobianconstraintmap,
-    const std::map<int, int>& tagmultiplicity,
-    GCS::VEC_pD& pdiagnoselist,
-    Eigen::MatrixXd& R,
-    int constrNum,
-    int rank,
-    int& nonredundantconstrNum)
+void System::identifyConflictGroups(const T& qrJT,
+                                    Eigen::MatrixXd& R,
+                                    int rank,
+                                    std::vector<std::vector<int>>& conflictGroups)
 {
     eliminateNonZerosOverPivotInUpperTriangularMatrix(R, rank);
 
-    std::vector<std::vector<Constraint*>> conflictGroups(constrNum - rank);
+    int constrNum = qrJT.cols();
+    conflictGroups.resize(constrNum - rank);
     for (int j = rank; j < constrNum; j++) {
         for (int row = 0; row < rank; row++) {
             if (fabs(R(row, j)) > 1e-10) {
                 int origCol = qrJT.colsPermutation().indices()[row];
 
-                conflictGroups[j - rank].push_back(clist[jacobianconstraintmap.at(origCol)]);
+                conflictGroups[j - rank].push_back(origCol);
             }
         }
         int origCol = qrJT.colsPermutation().indices()[j];
 
-        conflictGroups[j - rank].push_back(clist[jacobianconstraintmap.at(origCol)]);
+        conflictGroups[j - rank].push_back(origCol);
     }
+}
 
+void System::identifyConflictingRedundantConstraints(
+    Algorithm alg,
+    std::vector<std::vector<Constraint*>>& conflictGroups,
+    const std::map<int, int>& tagmultiplicity,
+    GCS::VEC_pD& pdiagnoselist,
+    int constrNum,
+    int& nonredundantconstrNum)
+{
     // Augment the information regarding the group of constraints that are conflicting or redundant.
     if (debugMode == IterationLevel) {
         SolverReportingManager::Manager().LogGroupOfConstraints(
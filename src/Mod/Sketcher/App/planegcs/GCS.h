@@ -23,6 +23,8 @@
 #ifndef PLANEGCS_GCS_H
 #define PLANEGCS_GCS_H
 
+#include <unordered_map>
+
 #include <Eigen/QR>
 
 #include "../../SketcherGlobal.h"
@@ -69,7 +71,8 @@ enum DogLegGaussStep
 {
     FullPivLU = 0,
     LeastNormFullPivLU = 1,
-    LeastNormLdlt = 2
+    LeastNormLdlt = 2,
+    LeastNormSparseLdlt = 3  // LeastNormLdlt with a sparse Jacobian, for large sketches
 };
 
 enum QRAlgorithm
@@ -146,6 +149,16 @@ private:
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
+    template<typename Jacobian>
+    int solve_DL(SubSystem* subsys, bool isRedundantsolving);
+    void calcGaussStep(SubSystem* subsys,
+                       const Eigen::MatrixXd& Jx,
+                       const Eigen::VectorXd& fx,
+                       Eigen::VectorXd& h_gn);
+    void calcGaussStep(SubSystem* subsys,
+                       const Eigen::SparseMatrix<double>& Jx,
+                       const Eigen::VectorXd& fx,
+                       Eigen::VectorXd& h_gn);
 
     void makeReducedJacobian(Eigen::MatrixXd& J,
                              std::map<int, int>& jacobianconstraintmap,
@@ -179,36 +192,59 @@ private:
         int paramsNum,
         int rank);
 
+    // The diagnosis of a decoupled block of the reduced Jacobian. The groups refer to the rows
+    // (constraints) and columns (parameters) of the block.
+    struct DiagnosedBlock
+    {
+        Eigen::MatrixXd J;
+        QRAlgorithm qrAlgorithm;
+        double qrpivotThreshold;
+        int rank = 0;
+        std::vector<std::vector<int>> conflictGroups;
+        std::vector<std::vector<int>> dependentParameterGroups;
+
+        std::size_t hash() const;
+        bool isSameInput(const DiagnosedBlock& other) const;
+    };
+
+    void diagnoseBlock(DiagnosedBlock& block);
+
+    // blocks of the last diagnosis by hash, reused by the next diagnosis if they did not change
+    std::unordered_multimap<std::size_t, DiagnosedBlock> diagnosedBlocks;
+
     template<typename T>
-    void identifyConflictingRedundantConstraints(Algorithm alg,
-                                                 const T& qrJT,
-                                                 const std::map<int, int>& jacobianconstraintmap,
-                                                 const std::map<int, int>& tagmultiplicity,
-                                                 GCS::VEC_pD& pdiagnoselist,
-                                                 Eigen::MatrixXd& R,
-                                                 int constrNum,
-                                                 int rank,
-                                                 int& nonredundantconstrNum);
+    void identifyConflictGroups(const T& qrJT,
+                                Eigen::MatrixXd& R,
+                                int rank,
+                                std::vector<std::vector<int>>& conflictGroups);
+
+    void identifyConflictingRedundantConstraints(
+        Algorithm alg,
+        std::vector<std::vector<Constraint*>>& conflictGroups,
+        const std::map<int, int>& tagmultiplicity,
+        GCS::VEC_pD& pdiagnoselist,
+        int constrNum,
+        int& nonredundantconstrNum);
 
     void eliminateNonZerosOverPivotInUpperTriangularMatrix(Eigen::MatrixXd& R, int rank);
 
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
-    void identifyDependentParametersSparseQR(const Eigen::MatrixXd& J,
-                                             const std::map<int, int>& jacobianconstraintmap,
-                                             const GCS::VEC_pD& pdiagnoselist,
-                                             bool silent = true);
+    std::vector<std::vector<int>>
+    identifyDependentParametersSparseQR(const Eigen::MatrixXd& J,
+                                        const std::map<int, int>& jacobianconstraintmap,
+                                        bool silent = true);
 #endif
 
-    void identifyDependentParametersDenseQR(const Eigen::MatrixXd& J,
-                                            const std::map<int, int>& jacobianconstraintmap,
-                                            const GCS::VEC_pD& pdiagnoselist,
-                                            bool silent = true);
+    std::vector<std::vector<int>>
+    identifyDependentParametersDenseQR(const Eigen::MatrixXd& J,
+                                       const std::map<int, int>& jacobianconstraintmap,
+                                       bool silent = true);
 
     template<typename T>
     void identifyDependentParameters(T& qrJ,
                                      Eigen::MatrixXd& Rparams,
                                      int rank,
-                                     const GCS::VEC_pD& pdiagnoselist,
+                                     std::vector<std::vector<int>>& groups,
                                      bool silent = true);
 
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
@@ -226,6 +262,8 @@ public:
     DogLegGaussStep dogLegGaussStep;
     double qrpivotThreshold;
     DebugMode debugMode;
+    int parallelSolveMinParams;  // decoupled components are solved concurrently if they have
+                                 // at least this many parameters in total
     double LM_eps;
     double LM_eps1;
     double LM_tau;
@@ -538,6 +576,8 @@ public:
     double calculateConstraintErrorByTag(int tagId);
 
     void rescaleConstraint(int id, double coeff);
+    // resets the scale of all constraints, e.g. after the geometry changed
+    void rescaleConstraints();
 
     void declareUnknowns(VEC_pD& params);
     void declareDrivenParams(VEC_pD& params);
@@ -273,7 +273,52 @@ void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
 
 void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
 {
-    calcJacobi(plist, jacobi);
+    // c2p holds the only parameters with non-zero derivatives
+    jacobi.setZero(csize, psize);
+    for (int i = 0; i < csize; i++) {
+        auto it = c2p.find(clist[i]);
+        if (it == c2p.end()) {
+            continue;
+        }
+        for (double* param : it->second) {
+            jacobi(i, param - pvals.data()) = clist[i]->grad(param);
+        }
+    }
+}
+
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    // all entries in c2p are inserted, even if zero, so that the sparsity pattern
+    // stays the same during the iterations
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < csize; i++) {
+        auto it = c2p.find(clist[i]);
+        if (it == c2p.end()) {
+            continue;
+        }
+        for (double* param : it->second) {
+            triplets.emplace_back(i, param - pvals.data(), clist[i]->grad(param));
+        }
+    }
+    jacobi.resize(csize, psize);
+    jacobi.setFromTriplets(triplets.begin(), triplets.end());
+}
+
+bool SubSystem::solveLeastNorm(const Eigen::SparseMatrix<double>& jacobi,
+                               const Eigen::VectorXd& rhs,
+                               Eigen::VectorXd& x)
+{
+    Eigen::SparseMatrix<double> jjt = jacobi * jacobi.transpose();
+    if (jjt.nonZeros() != jjtNonZeros) {
+        jjtLdlt.analyzePattern(jjt);
+        jjtNonZeros = jjt.nonZeros();
+    }
+    jjtLdlt.factorize(jjt);
+    if (jjtLdlt.info() != Eigen::Success) {
+        return false;
+    }
+    x = jacobi.transpose() * jjtLdlt.solve(rhs);
+    return jjtLdlt.info() == Eigen::Success;
 }
 
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
@@ -27,6 +27,7 @@
 #undef max
 
 #include <Eigen/Core>
+#include <Eigen/SparseCholesky>
 
 #include "Constraints.h"
 
@@ -45,6 +46,10 @@ private:
                      //        JacobianMatrix jacobi;  // jacobi matrix of the residuals
     std::map<Constraint*, VEC_pD> c2p;                // constraint to parameter adjacency list
     std::map<double*, std::vector<Constraint*>> p2c;  // parameter to constraint adjacency list
+    // factorization of J*J^T for the sparse least norm Gauss step. Its symbolic analysis
+    // only depends on c2p, so it is kept for all iterations and solves of the subsystem
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> jjtLdlt;
+    Eigen::Index jjtNonZeros = -1;  // number of non-zeros of the analyzed J*J^T
     void initialize(VEC_pD& params, MAP_pD_pD& reductionmap);  // called by the constructors
 public:
     SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params);
@@ -78,6 +83,11 @@ public:
     void calcResidual(Eigen::VectorXd& r, double& err);
     void calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi);
     void calcJacobi(Eigen::MatrixXd& jacobi);
+    void calcJacobi(Eigen::SparseMatrix<double>& jacobi);
+    // least norm solution of jacobi * x = rhs, returns false if J*J^T is singular
+    bool solveLeastNorm(const Eigen::SparseMatrix<double>& jacobi,
+                        const Eigen::VectorXd& rhs,
+                        Eigen::VectorXd& x);
     void calcGrad(VEC_pD& params, Eigen::VectorXd& grad);
     void calcGrad(Eigen::VectorXd& grad);
 
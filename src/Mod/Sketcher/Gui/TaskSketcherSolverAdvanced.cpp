@@ -48,7 +48,8 @@
 #define QR_PIVOT_THRESHOLD 1E-13  // under this value a Jacobian value is regarded as zero
 #define DEFAULT_SOLVER_DEBUG 1    // None=0, Minimal=1, IterationLevel=2
 #define MAX_ITER_MULTIPLIER false
-#define DEFAULT_DOGLEG_GAUSS_STEP 0  // FullPivLU = 0, LeastNormFullPivLU = 1, LeastNormLdlt = 2
+// FullPivLU = 0, LeastNormFullPivLU = 1, LeastNormLdlt = 2, LeastNormSparseLdlt = 3
+#define DEFAULT_DOGLEG_GAUSS_STEP 0
 
 using namespace SketcherGui;
 using namespace Gui::TaskView;
@@ -29,6 +29,10 @@
 #include <sstream>
 #endif
 
+#include <future>
+#include <optional>
+#include <thread>
+
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DynamicProperty.h>
@@ -753,7 +757,7 @@ struct CurrentAddressLock
  *
  */
 
-void Sheet::updateProperty(CellAddress key)
+void Sheet::updateProperty(CellAddress key, const App::NumericValue* value)
 {
     Cell* cell = getCell(key);
 
@@ -761,7 +765,11 @@ void Sheet::updateProperty(CellAddress key)
         std::unique_ptr<Expression> output;
         const Expression* input = cell->getExpression();
 
-        if (input) {
+        if (input && value) {
+            // already evaluated by recomputeIndependentCells()
+            output = std::make_unique<NumberExpression>(this, value->quantity);
+        }
+        else if (input) {
             CurrentAddressLock lock(currentRow, currentCol, key);
             output.reset(input->eval());
         }
@@ -889,9 +897,10 @@ void Sheet::recomputeCells(Range range)
 /**
  * @brief Recompute cell at address \a p.
  * @param p Address of cell.
+ * @param value Value of the cell's expression if it has already been evaluated.
  */
 
-void Sheet::recomputeCell(CellAddress p)
+void Sheet::recomputeCell(CellAddress p, const App::NumericValue* value)
 {
     Cell* cell = cells.getValue(p);
 
@@ -900,9 +909,10 @@ void Sheet::recomputeCell(CellAddress p)
             std::string content;
             cell->getStringContent(content);
             cell->setContent(content.c_str());
+            value = nullptr;
         }
 
-        updateProperty(p);
+        updateProperty(p, value);
 
         if (!cell || !cell->hasException()) {
             cells.clearDirty(p);
@@ -930,6 +940,62 @@ void Sheet::recomputeCell(CellAddress p)
     }
 }
 
+/**
+ * @brief Recompute cells that do not depend on each other.
+ *
+ * The expressions that can be evaluated without Python are evaluated in parallel
+ * first. The results are then applied one cell after the other, because setting
+ * the cell properties modifies the sheet.
+ *
+ * @param addresses Addresses of the cells.
+ */
+
+void Sheet::recomputeIndependentCells(const std::vector<CellAddress>& addresses)
+{
+    // Not worth the overhead of starting threads for a few cells
+    const std::size_t minParallelCells = 64;
+
+    std::vector<std::optional<App::NumericValue>> values(addresses.size());
+    if (addresses.size() >= minParallelCells) {
+        std::vector<const Expression*> expressions;
+        expressions.reserve(addresses.size());
+        for (const auto& addr : addresses) {
+            const Cell* cell = cells.getValue(addr);
+            bool valid = cell && !cell->hasException();
+            expressions.push_back(valid ? cell->getExpression() : nullptr);
+        }
+
+        auto evaluate = [&expressions, &values](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                App::NumericValue value;
+                try {
+                    if (expressions[i] && expressions[i]->getNumericValue(value)) {
+                        values[i] = value;
+                    }
+                }
+                catch (...) {
+                    // recomputeCell() evaluates it again and reports the error
+                }
+            }
+        };
+
+        std::size_t numThreads = std::max(1U, std::thread::hardware_concurrency());
+        std::size_t chunk = (addresses.size() + numThreads - 1) / numThreads;
+        std::vector<std::future<void>> tasks;
+        for (std::size_t begin = 0; begin < addresses.size(); begin += chunk) {
+            std::size_t end = std::min(begin + chunk, addresses.size());
+            tasks.push_back(std::async(std::launch::async, evaluate, begin, end));
+        }
+        for (auto& task : tasks) {
+            task.get();
+        }
+    }
+
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        recomputeCell(addresses[i], values[i] ? &*values[i] : nullptr);
+    }
+}
+
 PropertySheet::BindingType Sheet::getCellBinding(Range& range,
                                                  ExpressionPtr* pStart,
                                                  ExpressionPtr* pEnd,
@@ -1071,12 +1137,27 @@ DocumentObjectExecReturn* Sheet::execute()
     // Sort graph topologically to find evaluation order
     try {
         boost::topological_sort(graph, std::front_inserter(make_order));
+
+        // Group the cells by their distance from the changed cells. Cells of the
+        // same level do not depend on each other.
+        std::vector<int> levels(boost::num_vertices(graph), 0);
+        std::vector<std::vector<CellAddress>> schedule;
+        for (auto& pos : make_order) {
+            int level = levels[pos];
+            if (static_cast<int>(schedule.size()) <= level) {
+                schedule.resize(level + 1);
+            }
+            schedule[level].push_back(VertexIndexList[pos]);
+            Traits::adjacency_iterator it, end;
+            for (boost::tie(it, end) = boost::adjacent_vertices(pos, graph); it != end; ++it) {
+                levels[*it] = std::max(levels[*it], level + 1);
+            }
+        }
+
         // Recompute cells
         FC_LOG("recomputing " << getFullName());
-        for (auto& pos : make_order) {
-            const auto& addr = VertexIndexList[pos];
-            FC_TRACE(addr.toString());
-            recomputeCell(addr);
+        for (const auto& addresses : schedule) {
+            recomputeIndependentCells(addresses);
         }
     }
     catch (std::exception&) {
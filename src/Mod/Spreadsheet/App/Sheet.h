@@ -29,6 +29,7 @@
 #endif
 
 #include <map>
+#include <vector>
 
 #include <App/DocumentObject.h>
 #include <App/DynamicProperty.h>
@@ -243,13 +244,15 @@ protected:
 
     void onDocumentRestored() override;
 
-    void recomputeCell(App::CellAddress p);
+    void recomputeCell(App::CellAddress p, const App::NumericValue* value = nullptr);
+
+    void recomputeIndependentCells(const std::vector<App::CellAddress>& addresses);
 
     App::Property* getProperty(App::CellAddress key) const;
 
     App::Property* getProperty(const char* addr) const;
 
-    void updateProperty(App::CellAddress key);
+    void updateProperty(App::CellAddress key, const App::NumericValue* value = nullptr);
 
     App::Property* setStringProperty(App::CellAddress key, const std::string& value);
 
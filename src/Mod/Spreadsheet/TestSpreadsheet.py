@@ -1572,6 +1572,34 @@ class SpreadsheetCases(unittest.TestCase):
         self.assertLess(abs(sheet.F4.Value - -1.6971), 0.0001)
         self.assertEqual(sheet.F5, FreeCAD.Vector(1.72, 2.96, 4.2))
 
+    def testParallelRecompute(self):
+        """Test that independent cells evaluated in parallel match the serial evaluation"""
+        sheet = self.doc.addObject("Spreadsheet::Sheet", "Spreadsheet")
+        expressions = []
+        # more than the minimum number of cells of one level to be evaluated in parallel
+        for i in range(1, 101):
+            if i % 3 == 0:
+                # functions are only evaluated through Python
+                expression = "sin({0}) * {0}".format(i)
+            elif i % 3 == 1:
+                expression = "{0} * 2 + 1 / {0}".format(i)
+            else:
+                expression = "{}mm * 2 - 1mm".format(i)
+            expressions.append(expression)
+            sheet.set("A{}".format(i), "=" + expression)
+        self.doc.recompute()
+
+        def split(value):
+            if isinstance(value, Units.Quantity):
+                return value.Value, value.Unit
+            return value, Units.Unit()
+
+        for i, expression in enumerate(expressions, 1):
+            value, unit = split(sheet.get("A{}".format(i)))
+            expected, expectedUnit = split(sheet.evalExpression(expression))
+            self.assertAlmostEqual(value, expected, 10, expression)
+            self.assertEqual(unit, expectedUnit, expression)
+
     def tearDown(self):
         # closing doc
         FreeCAD.closeDocument(self.doc.Name)
@@ -291,7 +291,7 @@ void DrawComplexSection::makeSectionCut(const TopoDS_Shape& baseShape)
         // This is important because this variable might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [this, baseShape]{this->makeAlignedPieces(baseShape);};
-        m_alignFuture = QtConcurrent::run(std::move(lambda));
+        m_alignFuture = QtConcurrent::run(viewThreadPool(), std::move(lambda));
         m_alignWatcher.setFuture(m_alignFuture);
         waitingForAlign(true);
     }
@@ -45,6 +45,10 @@
 #include <TopoDS_Shape.hxx>
 #endif
 #include <BOPAlgo_Builder.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <boost_geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 
 #include <Base/Console.h>
 #include <Base/Parameter.h>
@@ -58,6 +62,15 @@
 
 using namespace TechDraw;
 
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+namespace
+{
+using BoxPoint = bg::model::point<double, 2, bg::cs::cartesian>;
+using BoxValue = std::pair<bg::model::box<BoxPoint>, int>;
+}
+
 //===========================================================================
 // DrawProjectSplit
 //===========================================================================
@@ -591,15 +604,17 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeOverlapEdges(const std::vector<
     std::vector<TopoDS_Edge> outEdges;
     std::vector<TopoDS_Edge> overlapEdges;
     std::vector<bool> skipThisEdge(inEdges.size(), false);
+    //only edges with intersecting boxes can overlap (see isSubset), so there is no need to
+    //compare every pair of edges
+    std::vector<std::vector<int>> neighbors = getBoxNeighbors(getEdgeBoxes(inEdges, false, 0.1));
     int edgeCount = inEdges.size();
     int ie0 = 0;
     for (; ie0 < edgeCount; ie0++) {
         if (skipThisEdge.at(ie0)) {
             continue;
         }
-        int ie1 = ie0 + 1;
-        for (; ie1 < edgeCount; ie1++) {
-            if (skipThisEdge.at(ie1)) {
+        for (int ie1 : neighbors.at(ie0)) {
+            if (ie1 <= ie0 || skipThisEdge.at(ie1)) {
                 continue;
             }
             int rc = isSubset(inEdges.at(ie0), inEdges.at(ie1));
@@ -715,6 +730,63 @@ bool DrawProjectSplit::boxesIntersect(const TopoDS_Edge &edge0, const TopoDS_Edg
     return true;
 }
 
+//get the bounding boxes of the edges. The boxes are computed in parallel.
+std::vector<Bnd_Box> DrawProjectSplit::getEdgeBoxes(const std::vector<TopoDS_Edge>& edges,
+                                                    bool optimal,
+                                                    double gap)
+{
+    std::vector<Bnd_Box> boxes(edges.size());
+    OSD_Parallel::For(0, static_cast<int>(edges.size()), [&](int index) {
+        if (optimal) {
+            BRepBndLib::AddOptimal(edges[index], boxes[index]);
+        }
+        else {
+            BRepBndLib::Add(edges[index], boxes[index]);
+        }
+        boxes[index].SetGap(gap);
+    });
+    return boxes;
+}
+
+//for each box find the indexes (ascending) of the other boxes it intersects. The edges
+//are projected into the XY plane, so the boxes are put into a 2d r-tree and each box
+//only gets compared to its neighbours. Void boxes don't intersect anything.
+std::vector<std::vector<int>> DrawProjectSplit::getBoxNeighbors(const std::vector<Bnd_Box>& boxes)
+{
+    std::vector<BoxValue> values;
+    values.reserve(boxes.size());
+    int boxCount = boxes.size();
+    for (int iBox = 0; iBox < boxCount; iBox++) {
+        if (boxes[iBox].IsVoid()) {
+            continue;
+        }
+        double xMin, yMin, zMin, xMax, yMax, zMax;
+        boxes[iBox].Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        values.emplace_back(bg::model::box<BoxPoint>(BoxPoint(xMin, yMin), BoxPoint(xMax, yMax)),
+                            iBox);
+    }
+
+    //the packing constructor gives a better tree than inserting one box at a time
+    const bgi::rtree<BoxValue, bgi::quadratic<16>> tree(values.begin(), values.end());
+
+    //queries don't modify the tree, so they can run in parallel
+    std::vector<std::vector<int>> neighbors(boxes.size());
+    OSD_Parallel::For(0, static_cast<int>(values.size()), [&](int iValue) {
+        const BoxValue& value = values[iValue];
+        std::vector<BoxValue> found;
+        tree.query(bgi::intersects(value.first), std::back_inserter(found));
+        std::vector<int>& row = neighbors[value.second];
+        row.reserve(found.size());
+        for (const auto& other : found) {
+            if (other.second != value.second) {
+                row.push_back(other.second);
+            }
+        }
+        std::sort(row.begin(), row.end());
+    });
+    return neighbors;
+}
+
 //this is an aid to debugging and isn't used in normal processing.
 void DrawProjectSplit::dumpVertexMap(vertexMap verts)
 {
@@ -23,6 +23,7 @@
 #ifndef DrawProjectSplit_h_
 #define DrawProjectSplit_h_
 
+#include <Bnd_Box.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Vertex.hxx>
 
@@ -130,6 +131,10 @@ public:
                                               const TopoDS_Edge& e1);
     static bool                     boxesIntersect(const TopoDS_Edge& e0,
                                                    const TopoDS_Edge& e1);
+    static std::vector<Bnd_Box>     getEdgeBoxes(const std::vector<TopoDS_Edge>& edges,
+                                                 bool optimal,
+                                                 double gap);
+    static std::vector<std::vector<int>> getBoxNeighbors(const std::vector<Bnd_Box>& boxes);
     static void dumpVertexMap(vertexMap verts);
 
 };
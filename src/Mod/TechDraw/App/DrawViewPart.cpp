@@ -48,6 +48,8 @@
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
 #include <HLRAlgo_Projector.hxx>
+#include <QThread>
+#include <QThreadPool>
 #include <QtConcurrentRun>
 #include <ShapeAnalysis.hxx>
 #include <TopExp.hxx>
@@ -64,6 +66,7 @@
 #include <gp_Pnt.hxx>
 #include <sstream>
 #endif
+#include <OSD_Parallel.hxx>
 
 #include <App/Document.h>
 #include <Base/BoundBox.h>
@@ -102,7 +105,9 @@ DrawViewPart::DrawViewPart()
       m_handleFaces(false),
       nowUnsetting(false),
       m_waitingForFaces(false),
-      m_waitingForHlr(false)
+      m_waitingForHlr(false),
+      m_hlrTime(-1.0),
+      m_faceTime(-1.0)
 {
     static const char* group = "Projection";
     static const char* sgroup = "HLR Parameters";
@@ -343,6 +348,7 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
 {
 //    Base::Console().Message("DVP::buildGeometryObject() - %s\n", getNameInDocument());
     showProgressMessage(getNameInDocument(), "is finding hidden lines");
+    m_hlrStart = std::chrono::steady_clock::now();
 
     TechDraw::GeometryObjectPtr go(
         std::make_shared<TechDraw::GeometryObject>(getNameInDocument(), this));
@@ -351,6 +357,7 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     go->setFocus(Focus.getValue());
     go->usePolygonHLR(CoarseView.getValue());
     go->setScrubCount(ScrubCount.getValue());
+    go->splitHlr(Preferences::splitHlr());
 
     if (CoarseView.getValue()) {
         //the polygon approximation HLR process runs quickly, so doesn't need to be in a
@@ -369,7 +376,7 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         // This is important because those variables might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [go, shape, viewAxis]{go->projectShape(shape, viewAxis);};
-        m_hlrFuture = QtConcurrent::run(std::move(lambda));
+        m_hlrFuture = QtConcurrent::run(viewThreadPool(), std::move(lambda));
         m_hlrWatcher.setFuture(m_hlrFuture);
         waitingForHlr(true);
     }
@@ -401,6 +408,8 @@ void DrawViewPart::onHlrFinished()
     waitingForHlr(false);
     QObject::disconnect(connectHlrWatcher);
     showProgressMessage(getNameInDocument(), "has finished finding hidden lines");
+    m_hlrTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_hlrStart).count();
+    Base::Console().Log("DVP - %s - hidden lines found in %.3f s\n", getNameInDocument(), m_hlrTime);
 
     postHlrTasks();//application level tasks that depend on HLR/GO being complete
 
@@ -415,8 +424,9 @@ void DrawViewPart::onHlrFinished()
                 QObject::connect(&m_faceWatcher, &QFutureWatcherBase::finished, &m_faceWatcher,
                                  [this] { this->onFacesFinished(); });
 
+            m_faceStart = std::chrono::steady_clock::now();
             auto lambda = [this]{this->extractFaces();};
-            m_faceFuture = QtConcurrent::run(std::move(lambda));
+            m_faceFuture = QtConcurrent::run(viewThreadPool(), std::move(lambda));
             m_faceWatcher.setFuture(m_faceFuture);
             waitingForFaces(true);
         }
@@ -599,60 +609,48 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {//*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::AddOptimal(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            continue;                   //skip zero length edges. shouldn't happen ;)
+    //only the edges whose bboxes intersect the bbox of the outer edge are checked. Each outer
+    //edge collects its own splits, so the outer edges can be processed in parallel.
+    std::vector<Bnd_Box> boxes = DrawProjectSplit::getEdgeBoxes(nonZero, true, 0.1);
+    std::vector<std::vector<int>> neighbors = DrawProjectSplit::getBoxNeighbors(boxes);
+    std::vector<std::vector<splitPoint>> outerSplits(nonZero.size());
+    OSD_Parallel::For(0, static_cast<int>(nonZero.size()), [&](int iOuter) {
+        const TopoDS_Edge& outer = nonZero[iOuter];
+        TopoDS_Vertex v1 = TopExp::FirstVertex(outer);
+        TopoDS_Vertex v2 = TopExp::LastVertex(outer);
+        if (DrawUtil::isZeroEdge(outer)) {
+            return;                   //skip zero length edges. shouldn't happen ;)
         }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();//***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner, iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
+        for (int iInner : neighbors[iOuter]) {
+            const TopoDS_Edge& inner = nonZero[iInner];
+            if (DrawUtil::isZeroEdge(inner)) {
                 continue;//skip zero length edges. shouldn't happen ;)
             }
 
-            Bnd_Box sInner;
-            BRepBndLib::AddOptimal(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {//bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
             double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner), v1, param, false)) {
+            if (DrawProjectSplit::isOnEdge(inner, v1, param, false)) {
                 gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
                 splitPoint s1;
                 s1.i = iInner;
                 s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
                 s1.param = param;
-                splits.push_back(s1);
+                outerSplits[iOuter].push_back(s1);
             }
-            if (DrawProjectSplit::isOnEdge((*itInner), v2, param, false)) {
+            if (DrawProjectSplit::isOnEdge(inner, v2, param, false)) {
                 gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
                 splitPoint s2;
                 s2.i = iInner;
                 s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
                 s2.param = param;
-                splits.push_back(s2);
+                outerSplits[iOuter].push_back(s2);
             }
         }//inner loop
-    }    //outer loop
+    });  //outer loop
+
+    std::vector<splitPoint> splits;
+    for (auto& edgeSplits : outerSplits) {
+        splits.insert(splits.end(), edgeSplits.begin(), edgeSplits.end());
+    }
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits, true);
     auto last = std::unique(sorted.begin(), sorted.end(),
@@ -700,6 +698,8 @@ void DrawViewPart::onFacesFinished()
     waitingForFaces(false);
     QObject::disconnect(connectFaceWatcher);
     showProgressMessage(getNameInDocument(), "has finished extracting faces");
+    m_faceTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_faceStart).count();
+    Base::Console().Log("DVP - %s - faces extracted in %.3f s\n", getNameInDocument(), m_faceTime);
 
     // Now we can recompute Dimensions and do other tasks possibly depending on Face extraction
     postFaceExtractionTasks();
@@ -707,6 +707,22 @@ void DrawViewPart::onFacesFinished()
     requestPaint();
 }
 
+//! The background tasks (HLR, face finding, cutting, ...) of all views share this pool, so
+//! that the views of a page (or of all pages while opening a document) are processed
+//! concurrently, but with no more threads than configured in the preferences.
+QThreadPool* DrawViewPart::viewThreadPool()
+{
+    static QThreadPool pool;
+    int maxThreads = Preferences::maxConcurrentViews();
+    if (maxThreads <= 0) {
+        maxThreads = QThread::idealThreadCount();
+    }
+    if (pool.maxThreadCount() != maxThreads) {
+        pool.setMaxThreadCount(maxThreads);
+    }
+    return &pool;
+}
+
 //retrieve all the face hatches associated with this dvp
 std::vector<TechDraw::DrawHatch*> DrawViewPart::getHatches() const
 {
@@ -25,6 +25,8 @@
 #ifndef DrawViewPart_h_
 #define DrawViewPart_h_
 
+#include <chrono>
+
 #include <QFuture>
 #include <QFutureWatcher>
 
@@ -41,6 +43,7 @@
 #include "DrawView.h"
 
 
+class QThreadPool;
 class gp_Pnt;
 class gp_Pln;
 class gp_Ax2;
@@ -212,6 +215,10 @@ public:
     void waitingForHlr(bool s) { m_waitingForHlr = s; }
     virtual bool waitingForResult() const;
     void progressValueChanged(int v);
+    static QThreadPool* viewThreadPool();
+    //! seconds from the start of HLR/face finding until the results were available (-1 = never)
+    double getHlrTime() const { return m_hlrTime; }
+    double getFaceTime() const { return m_faceTime; }
 
 public Q_SLOTS:
     void onHlrFinished(void);
@@ -258,6 +265,10 @@ private:
     QFutureWatcher<void> m_faceWatcher;
     QFuture<void> m_faceFuture;
 
+    std::chrono::steady_clock::time_point m_hlrStart;
+    std::chrono::steady_clock::time_point m_faceStart;
+    double m_hlrTime;
+    double m_faceTime;
 };
 
 using DrawViewPartPython = App::FeaturePythonT<DrawViewPart>;
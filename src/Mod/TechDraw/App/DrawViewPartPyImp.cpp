@@ -27,6 +27,7 @@
 # include <gp_Pnt.hxx>
 # include <TopoDS.hxx>
 # include <TopoDS_Edge.hxx>
+# include <TopoDS_Face.hxx>
 # include <TopoDS_Shape.hxx>
 #endif
 
@@ -36,6 +37,7 @@
 
 #include <Mod/Part/App/TopoShape.h>
 #include <Mod/Part/App/TopoShapeEdgePy.h>
+#include <Mod/Part/App/TopoShapeFacePy.h>
 #include <Mod/Part/App/TopoShapeVertexPy.h>
 
 #include "CenterLine.h"
@@ -98,6 +100,27 @@ PyObject* DrawViewPartPy::getHiddenEdges(PyObject *args)
     return Py::new_reference_to(pEdgeList);
 }
 
+PyObject* DrawViewPartPy::getFaces(PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    DrawViewPart* dvp = getDrawViewPartPtr();
+    Py::List pFaceList;
+    std::vector<TechDraw::FacePtr> faces = dvp->getFaceGeometry();
+    for (auto& f: faces) {
+        TopoDS_Face occFace = f->toOccFace();
+        if (occFace.IsNull()) {
+            continue;
+        }
+        PyObject* pFace = new Part::TopoShapeFacePy(new Part::TopoShape(occFace));
+        pFaceList.append(Py::asObject(pFace));
+    }
+
+    return Py::new_reference_to(pFaceList);
+}
+
 PyObject* DrawViewPartPy::getVisibleVertexes(PyObject *args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -161,6 +184,19 @@ PyObject* DrawViewPartPy::getGeometricCenter(PyObject *args)
     return new Base::VectorPy(new Base::Vector3d(pointOut));
 }
 
+PyObject* DrawViewPartPy::getTimings(PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    DrawViewPart* dvp = getDrawViewPartPtr();
+    Py::Dict timings;
+    timings.setItem("HLR", Py::Float(dvp->getHlrTime()));
+    timings.setItem("Faces", Py::Float(dvp->getFaceTime()));
+    return Py::new_reference_to(timings);
+}
+
 
 // remove all cosmetics
 PyObject* DrawViewPartPy::clearCosmeticVertices(PyObject *args)
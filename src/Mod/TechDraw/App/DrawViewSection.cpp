@@ -473,7 +473,7 @@ void DrawViewSection::sectionExec(TopoDS_Shape& baseShape)
         // This is important because this variable might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [this, baseShape]{this->makeSectionCut(baseShape);};
-        m_cutFuture = QtConcurrent::run(std::move(lambda));
+        m_cutFuture = QtConcurrent::run(viewThreadPool(), std::move(lambda));
         m_cutWatcher.setFuture(m_cutFuture);
         waitingForCut(true);
     }
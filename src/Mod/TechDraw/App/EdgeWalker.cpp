@@ -28,7 +28,9 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <array>
 # include <cmath>
+# include <map>
 # include <sstream>
 # include <BRep_Tool.hxx>
 # include <BRepBuilderAPI_MakeWire.hxx>
@@ -49,6 +51,61 @@
 using namespace TechDraw;
 using namespace boost;
 
+namespace
+{
+//! a grid of points with cells the size of the tolerance, so that looking up a point only
+//! compares it to the points in the neighbouring cells instead of all points
+class VertexGrid
+{
+public:
+    explicit VertexGrid(double tolerance) : m_tolerance(tolerance) {}
+
+    //! index of the first added point within tolerance of point, or SIZE_MAX
+    std::size_t find(const Base::Vector3d& point) const
+    {
+        std::size_t result = SIZE_MAX;
+        Cell center = cellOf(point);
+        for (long long dx = -1; dx <= 1; dx++) {
+            for (long long dy = -1; dy <= 1; dy++) {
+                for (long long dz = -1; dz <= 1; dz++) {
+                    auto it = m_cells.find({center[0] + dx, center[1] + dy, center[2] + dz});
+                    if (it == m_cells.end()) {
+                        continue;
+                    }
+                    for (std::size_t index : it->second) {
+                        if (index < result && m_points[index].IsEqual(point, m_tolerance)) {
+                            result = index;
+                        }
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    //! the index of an added point is the number of points added before it
+    void add(const Base::Vector3d& point)
+    {
+        m_cells[cellOf(point)].push_back(m_points.size());
+        m_points.push_back(point);
+    }
+
+private:
+    using Cell = std::array<long long, 3>;
+
+    Cell cellOf(const Base::Vector3d& point) const
+    {
+        return {static_cast<long long>(std::floor(point.x / m_tolerance)),
+                static_cast<long long>(std::floor(point.y / m_tolerance)),
+                static_cast<long long>(std::floor(point.z / m_tolerance))};
+    }
+
+    double m_tolerance;
+    std::vector<Base::Vector3d> m_points;
+    std::map<Cell, std::vector<std::size_t>> m_cells;
+};
+}
+
 //*******************************************************
 //* edgeVisior methods
 //*******************************************************
@@ -270,26 +327,20 @@ std::vector<TopoDS_Vertex> EdgeWalker:: makeUniqueVList(std::vector<TopoDS_Edge>
 {
 //    Base::Console().Message("TRACE - EW::makeUniqueVList() - edgesIn: %d\n", edges.size());
     std::vector<TopoDS_Vertex> uniqueVert;
+    VertexGrid grid(EWTOLERANCE);
     for(auto& e:edges) {
         Base::Vector3d v1 = DrawUtil::vertex2Vector(TopExp::FirstVertex(e));
         Base::Vector3d v2 = DrawUtil::vertex2Vector(TopExp::LastVertex(e));
-        bool addv1 = true;
-        bool addv2 = true;
         //check if we've already added this vertex
-        for (const auto& v: uniqueVert) {
-            Base::Vector3d v3d = DrawUtil::vertex2Vector(v);
-            if (v3d.IsEqual(v1, EWTOLERANCE)) {
-                addv1 = false;
-            }
-            if (v3d.IsEqual(v2, EWTOLERANCE)) {
-                addv2 = false;
-            }
-        }
+        bool addv1 = grid.find(v1) == SIZE_MAX;
+        bool addv2 = grid.find(v2) == SIZE_MAX;
         if (addv1) {
             uniqueVert.push_back(TopExp::FirstVertex(e));
+            grid.add(v1);
         }
         if (addv2) {
             uniqueVert.push_back(TopExp::LastVertex(e));
+            grid.add(v2);
         }
     }
 //    Base::Console().Message("EW::makeUniqueVList - verts out: %d\n", uniqueVert.size());
@@ -302,15 +353,20 @@ std::vector<WalkerEdge> EdgeWalker::makeWalkerEdges(std::vector<TopoDS_Edge> edg
 {
 //    Base::Console().Message("TRACE - EW::makeWalkerEdges() - edges: %d  verts: %d\n", edges.size(), verts.size());
     m_saveInEdges = edges;
+    //same result as findUniqueVert, without scanning all the vertexes for every edge
+    VertexGrid grid(EWTOLERANCE);
+    for (const auto& v : verts) {
+        grid.add(DrawUtil::vertex2Vector(v));
+    }
     std::vector<WalkerEdge> walkerEdges;
     for (const auto& e:edges) {
         TopoDS_Vertex edgeVertex1 = TopExp::FirstVertex(e);
         TopoDS_Vertex edgeVertex2 = TopExp::LastVertex(e);
-        std::size_t vertex1Index = findUniqueVert(edgeVertex1, verts);
+        std::size_t vertex1Index = grid.find(DrawUtil::vertex2Vector(edgeVertex1));
         if (vertex1Index == SIZE_MAX) {
             continue;
         }
-        std::size_t vertex2Index = findUniqueVert(edgeVertex2, verts);
+        std::size_t vertex2Index = grid.find(DrawUtil::vertex2Vector(edgeVertex2));
         if (vertex2Index == SIZE_MAX) {
             continue;
         }
@@ -389,29 +445,25 @@ std::vector<embedItem> EdgeWalker::makeEmbedding(const std::vector<TopoDS_Edge>
 //                            edges.size(), uniqueVList.size());
     std::vector<embedItem> result;
 
-    std::size_t iVert = 0;
+    //collect the edges that have v as first or last vertex for each vertex v in uniqueVList.
+    //the walker edges already know the index of their end vertexes, so the vertexes
+    //don't have to be compared to every edge.
+    std::vector<std::vector<incidenceItem>> incidence(uniqueVList.size());
+    std::size_t iEdge = 0;
+    for (auto& e: edges) {
+        const WalkerEdge& we = m_saveWalkerEdges[iEdge];
+        double angle = DrawUtil::incidenceAngleAtVertex(e, uniqueVList[we.v1], EWTOLERANCE);
+        incidence[we.v1].push_back(incidenceItem(iEdge, angle, we.ed));
+        if (we.v2 != we.v1) {
+            angle = DrawUtil::incidenceAngleAtVertex(e, uniqueVList[we.v2], EWTOLERANCE);
+            incidence[we.v2].push_back(incidenceItem(iEdge, angle, we.ed));
+        }
+        iEdge++;
+    }
+
     //make an embedItem for each vertex in uniqueVList
-    //for each vertex v
-    //  find all the edges that have v as first or last vertex
-    for (auto& v: uniqueVList) {
-        TopoDS_Vertex cv = v;               //v is const but we need non-const for vertexEqual
-        std::size_t iEdge = 0;
-        std::vector<incidenceItem> iiList;
-        for (auto& e: edges) {
-            double angle = 0;
-            TopoDS_Vertex edgeVertex1 = TopExp::FirstVertex(e);
-            TopoDS_Vertex edgeVertex2 = TopExp::LastVertex(e);
-            if (DrawUtil::vertexEqual(cv, edgeVertex1)) {
-                angle = DrawUtil::incidenceAngleAtVertex(e,v,EWTOLERANCE);
-                incidenceItem ii(iEdge, angle, m_saveWalkerEdges[iEdge].ed);
-                iiList.push_back(ii);
-            } else if (DrawUtil::vertexEqual(cv, edgeVertex2)) {
-                angle = DrawUtil::incidenceAngleAtVertex(e,v,EWTOLERANCE);
-                incidenceItem ii(iEdge, angle, m_saveWalkerEdges[iEdge].ed);
-                iiList.push_back(ii);
-            }
-            iEdge++;
-       }
+    std::size_t iVert = 0;
+    for (auto& iiList: incidence) {
        //sort incidenceList by angle
        iiList = embedItem::sortIncidenceList(iiList,  false);
        embedItem embed(iVert, iiList);
@@ -46,11 +46,14 @@
 #include <HLRBRep_HLRToShape.hxx>
 #include <HLRBRep_PolyAlgo.hxx>
 #include <HLRBRep_PolyHLRToShape.hxx>
+#include <OSD_Parallel.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <gp_Ax1.hxx>
@@ -64,6 +67,9 @@
 
 #include <algorithm>
 #include <chrono>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
 
 #include <Base/Console.h>
 #include <Mod/Part/App/PartFeature.h>
@@ -83,7 +89,7 @@ using DU = DrawUtil;
 
 GeometryObject::GeometryObject(const string& parent, TechDraw::DrawView* parentObj)
     : m_parentName(parent), m_parent(parentObj), m_isoCount(0), m_isPersp(false), m_focus(100.0),
-      m_usePolygonHLR(false), m_scrubCount(0)
+      m_usePolygonHLR(false), m_scrubCount(0), m_splitHlr(true)
 
 {}
 
@@ -140,17 +146,145 @@ void GeometryObject::clear()
     edgeGeom.clear();
 }
 
-void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis)
+namespace
 {
-    clear();
 
+//! the edge compounds produced by one run of the exact HLR algorithm
+struct HlrOutput
+{
+    TopoDS_Shape visHard;
+    TopoDS_Shape visOutline;
+    TopoDS_Shape visSmooth;
+    TopoDS_Shape visSeam;
+    TopoDS_Shape visIso;
+    TopoDS_Shape hidHard;
+    TopoDS_Shape hidOutline;
+    TopoDS_Shape hidSmooth;
+    TopoDS_Shape hidSeam;
+    TopoDS_Shape hidIso;
+};
+
+//! the non-compound sub shapes (solids, shells, faces, ...) of a shape
+void collectHlrItems(const TopoDS_Shape& shape, std::vector<TopoDS_Shape>& items)
+{
+    if (shape.IsNull()) {
+        return;
+    }
+    if (shape.ShapeType() == TopAbs_COMPOUND || shape.ShapeType() == TopAbs_COMPSOLID) {
+        for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+            collectHlrItems(it.Value(), items);
+        }
+        return;
+    }
+    items.push_back(shape);
+}
+
+//! Group the solids of a shape so that the projected bounding boxes of different groups don't
+//! overlap. Shapes in different groups can't hide each other in a parallel projection, so each
+//! group can be given to its own HLR run. Returns the input shape if it can't be split.
+std::vector<TopoDS_Shape> splitForHlr(const TopoDS_Shape& shape, const gp_Ax2& viewAxis)
+{
+    std::vector<TopoDS_Shape> items;
+    collectHlrItems(shape, items);
+    if (items.size() < 2) {
+        return {shape};
+    }
+
+    struct Extent
+    {
+        double xMin, xMax, yMin, yMax;
+    };
+    gp_Trsf toView;
+    toView.SetTransformation(gp_Ax3(viewAxis));
+    std::vector<Extent> extents;
+    extents.reserve(items.size());
+    for (const auto& item : items) {
+        Bnd_Box box;
+        BRepBndLib::Add(item, box, false);
+        if (box.IsVoid()) {
+            return {shape};
+        }
+        box.Enlarge(Precision::Confusion());
+        double xMin, yMin, zMin, xMax, yMax, zMax;
+        box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+
+        Extent extent {std::numeric_limits<double>::max(), -std::numeric_limits<double>::max(),
+                       std::numeric_limits<double>::max(), -std::numeric_limits<double>::max()};
+        for (int corner = 0; corner < 8; corner++) {
+            gp_Pnt point((corner & 1) ? xMax : xMin, (corner & 2) ? yMax : yMin,
+                         (corner & 4) ? zMax : zMin);
+            point.Transform(toView);
+            extent.xMin = std::min(extent.xMin, point.X());
+            extent.xMax = std::max(extent.xMax, point.X());
+            extent.yMin = std::min(extent.yMin, point.Y());
+            extent.yMax = std::max(extent.yMax, point.Y());
+        }
+        extents.push_back(extent);
+    }
+
+    // union the items with overlapping extents, sweeping along the x axis
+    std::vector<std::size_t> parent(items.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto findRoot = [&parent](std::size_t index) {
+        while (parent[index] != index) {
+            parent[index] = parent[parent[index]];
+            index = parent[index];
+        }
+        return index;
+    };
+    std::vector<std::size_t> order(items.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&extents](std::size_t a, std::size_t b) {
+        return extents[a].xMin < extents[b].xMin;
+    });
+    for (std::size_t i = 0; i < order.size(); i++) {
+        const Extent& current = extents[order[i]];
+        for (std::size_t j = i + 1; j < order.size() && extents[order[j]].xMin <= current.xMax;
+             j++) {
+            const Extent& other = extents[order[j]];
+            if (other.yMin <= current.yMax && current.yMin <= other.yMax) {
+                parent[findRoot(order[j])] = findRoot(order[i]);
+            }
+        }
+    }
+
+    BRep_Builder builder;
+    std::unordered_map<std::size_t, std::size_t> groupOfRoot;
+    std::vector<TopoDS_Compound> groups;
+    for (std::size_t i = 0; i < items.size(); i++) {
+        auto inserted = groupOfRoot.emplace(findRoot(i), groups.size());
+        if (inserted.second) {
+            groups.emplace_back();
+            builder.MakeCompound(groups.back());
+        }
+        builder.Add(groups[inserted.first->second], items[i]);
+    }
+    if (groups.size() < 2) {
+        return {shape};
+    }
+    return std::vector<TopoDS_Shape>(groups.begin(), groups.end());
+}
+
+TopoDS_Shape prepareHlrEdges(const TopoDS_Shape& edges)
+{
+    if (edges.IsNull()) {
+        return edges;
+    }
+    BRepLib::BuildCurves3d(edges);
+    return ShapeUtils::invertGeometry(edges);
+}
+
+//! set up the exact hidden line remover, project a shape with it and extract the edges
+HlrOutput runHlr(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis, int isoCount, bool isPersp,
+                 double focus)
+{
     Handle(HLRBRep_Algo) brep_hlr;
     try {
         brep_hlr = new HLRBRep_Algo();
         //        brep_hlr->Debug(true);
-        brep_hlr->Add(inShape, m_isoCount);
-        if (m_isPersp) {
-            double fLength = std::max(Precision::Confusion(), m_focus);
+        brep_hlr->Add(inShape, isoCount);
+        if (isPersp) {
+            double fLength = std::max(Precision::Confusion(), focus);
             HLRAlgo_Projector projector(viewAxis, fLength);
             brep_hlr->Projector(projector);
         }
@@ -170,80 +304,124 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
         throw Base::RuntimeError("GeometryObject::projectShape - unknown error");
     }
 
+    HlrOutput output;
     try {
         HLRBRep_HLRToShape hlrToShape(brep_hlr);
 
-        if (!hlrToShape.VCompound().IsNull()) {
-            visHard = hlrToShape.VCompound();
-            BRepLib::BuildCurves3d(visHard);
-            visHard =ShapeUtils::invertGeometry(visHard);
-            //            BRepTools::Write(visHard, "GOvisHard.brep");            //debug
-        }
-
-        if (!hlrToShape.Rg1LineVCompound().IsNull()) {
-            visSmooth = hlrToShape.Rg1LineVCompound();
-            BRepLib::BuildCurves3d(visSmooth);
-            visSmooth =ShapeUtils::invertGeometry(visSmooth);
-        }
-
-        if (!hlrToShape.RgNLineVCompound().IsNull()) {
-            visSeam = hlrToShape.RgNLineVCompound();
-            BRepLib::BuildCurves3d(visSeam);
-            visSeam =ShapeUtils::invertGeometry(visSeam);
-        }
+        output.visHard = prepareHlrEdges(hlrToShape.VCompound());
+        output.visSmooth = prepareHlrEdges(hlrToShape.Rg1LineVCompound());
+        output.visSeam = prepareHlrEdges(hlrToShape.RgNLineVCompound());
+        output.visOutline = prepareHlrEdges(hlrToShape.OutLineVCompound());
+        output.visIso = prepareHlrEdges(hlrToShape.IsoLineVCompound());
+        output.hidHard = prepareHlrEdges(hlrToShape.HCompound());
+        output.hidSmooth = prepareHlrEdges(hlrToShape.Rg1LineHCompound());
+        output.hidSeam = prepareHlrEdges(hlrToShape.RgNLineHCompound());
+        output.hidOutline = prepareHlrEdges(hlrToShape.OutLineHCompound());
+        output.hidIso = prepareHlrEdges(hlrToShape.IsoLineHCompound());
+    }
+    catch (const Standard_Failure&) {
+        throw Base::RuntimeError(
+            "GeometryObject::projectShape - OCC error occurred while extracting edges");
+    }
+    catch (...) {
+        throw Base::RuntimeError(
+            "GeometryObject::projectShape - unknown error occurred while extracting edges");
+    }
+    return output;
+}
 
-        if (!hlrToShape.OutLineVCompound().IsNull()) {
-            //            BRepTools::Write(hlrToShape.OutLineVCompound(), "GOOutLineVCompound.brep");            //debug
-            visOutline = hlrToShape.OutLineVCompound();
-            BRepLib::BuildCurves3d(visOutline);
-            visOutline =ShapeUtils::invertGeometry(visOutline);
+//! combine one category of edges of several HLR runs into a compound
+TopoDS_Shape mergeHlrEdges(const std::vector<HlrOutput>& parts, TopoDS_Shape HlrOutput::*category)
+{
+    BRep_Builder builder;
+    TopoDS_Compound result;
+    for (const auto& part : parts) {
+        const TopoDS_Shape& edges = part.*category;
+        if (edges.IsNull()) {
+            continue;
         }
-
-        if (!hlrToShape.IsoLineVCompound().IsNull()) {
-            visIso = hlrToShape.IsoLineVCompound();
-            BRepLib::BuildCurves3d(visIso);
-            visIso =ShapeUtils::invertGeometry(visIso);
+        if (result.IsNull()) {
+            builder.MakeCompound(result);
         }
+        builder.Add(result, edges);
+    }
+    return result;
+}
 
-        if (!hlrToShape.HCompound().IsNull()) {
-            hidHard = hlrToShape.HCompound();
-            BRepLib::BuildCurves3d(hidHard);
-            hidHard =ShapeUtils::invertGeometry(hidHard);
-        }
+HlrOutput mergeHlrOutput(const std::vector<HlrOutput>& parts)
+{
+    HlrOutput output;
+    output.visHard = mergeHlrEdges(parts, &HlrOutput::visHard);
+    output.visOutline = mergeHlrEdges(parts, &HlrOutput::visOutline);
+    output.visSmooth = mergeHlrEdges(parts, &HlrOutput::visSmooth);
+    output.visSeam = mergeHlrEdges(parts, &HlrOutput::visSeam);
+    output.visIso = mergeHlrEdges(parts, &HlrOutput::visIso);
+    output.hidHard = mergeHlrEdges(parts, &HlrOutput::hidHard);
+    output.hidOutline = mergeHlrEdges(parts, &HlrOutput::hidOutline);
+    output.hidSmooth = mergeHlrEdges(parts, &HlrOutput::hidSmooth);
+    output.hidSeam = mergeHlrEdges(parts, &HlrOutput::hidSeam);
+    output.hidIso = mergeHlrEdges(parts, &HlrOutput::hidIso);
+    return output;
+}
 
-        if (!hlrToShape.Rg1LineHCompound().IsNull()) {
-            hidSmooth = hlrToShape.Rg1LineHCompound();
-            BRepLib::BuildCurves3d(hidSmooth);
-            hidSmooth =ShapeUtils::invertGeometry(hidSmooth);
-        }
+}  // namespace
 
-        if (!hlrToShape.RgNLineHCompound().IsNull()) {
-            hidSeam = hlrToShape.RgNLineHCompound();
-            BRepLib::BuildCurves3d(hidSeam);
-            hidSeam =ShapeUtils::invertGeometry(hidSeam);
-        }
+void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis)
+{
+    clear();
 
-        if (!hlrToShape.OutLineHCompound().IsNull()) {
-            hidOutline = hlrToShape.OutLineHCompound();
-            BRepLib::BuildCurves3d(hidOutline);
-            hidOutline =ShapeUtils::invertGeometry(hidOutline);
-        }
+    int isoCount = m_isoCount;
+    bool isPersp = m_isPersp;
+    double focus = m_focus;
 
-        if (!hlrToShape.IsoLineHCompound().IsNull()) {
-            hidIso = hlrToShape.IsoLineHCompound();
-            BRepLib::BuildCurves3d(hidIso);
-            hidIso =ShapeUtils::invertGeometry(hidIso);
-        }
+    // the bounding boxes are not sufficient to decide about hiding in a perspective view
+    std::vector<TopoDS_Shape> groups;
+    if (isPersp || !m_splitHlr) {
+        groups.push_back(inShape);
     }
-    catch (const Standard_Failure&) {
-        throw Base::RuntimeError(
-            "GeometryObject::projectShape - OCC error occurred while extracting edges");
+    else {
+        groups = splitForHlr(inShape, viewAxis);
     }
-    catch (...) {
-        throw Base::RuntimeError(
-            "GeometryObject::projectShape - unknown error occurred while extracting edges");
+
+    HlrOutput output;
+    if (groups.size() == 1) {
+        output = runHlr(groups.front(), viewAxis, isoCount, isPersp, focus);
+    }
+    else {
+        // the groups don't share any data, and HLR already runs concurrently for
+        // different views
+        std::vector<HlrOutput> parts(groups.size());
+        std::vector<std::string> errors(groups.size());
+        OSD_Parallel::For(0, static_cast<int>(groups.size()), [&](int index) {
+            try {
+                parts[index] = runHlr(groups[index], viewAxis, isoCount, isPersp, focus);
+            }
+            catch (const Base::Exception& e) {
+                errors[index] = e.what();
+            }
+            catch (...) {
+                errors[index] = "GeometryObject::projectShape - unknown error";
+            }
+        });
+        for (const auto& error : errors) {
+            if (!error.empty()) {
+                throw Base::RuntimeError(error);
+            }
+        }
+        output = mergeHlrOutput(parts);
     }
 
+    visHard = output.visHard;
+    visOutline = output.visOutline;
+    visSmooth = output.visSmooth;
+    visSeam = output.visSeam;
+    visIso = output.visIso;
+    hidHard = output.hidHard;
+    hidOutline = output.hidOutline;
+    hidSmooth = output.hidSmooth;
+    hidSeam = output.hidSeam;
+    hidIso = output.hidIso;
+
     makeTDGeometry();
 }
 
@@ -95,6 +95,8 @@ public:
     bool isPerspective() { return m_isPersp; }
     void usePolygonHLR(bool b) { m_usePolygonHLR = b; }
     bool usePolygonHLR() const { return m_usePolygonHLR; }
+    //! project solids that can't hide each other in separate HLR runs
+    void splitHlr(bool b) { m_splitHlr = b; }
     void setFocus(double f) { m_focus = f; }
     double getFocus() { return m_focus; }
     void setScrubCount(int count) { m_scrubCount = count; }
@@ -165,6 +167,7 @@ protected:
     double m_focus;
     bool m_usePolygonHLR;
     int m_scrubCount;
+    bool m_splitHlr;
 };
 
 using GeometryObjectPtr = std::shared_ptr<GeometryObject>;
@@ -33,6 +33,7 @@
 
 // standard
 #include <algorithm>
+#include <array>
 #include <cstdio>
 #include <chrono>
 #include <fstream>
@@ -62,10 +63,13 @@
 #include <QLocale>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QThread>
+#include <QThreadPool>
 #include <QtConcurrentRun>
 
 // OpenCasCade
 #include <Mod/Part/App/OpenCascadeAll.h>
+#include <OSD_Parallel.hxx>
 
 #endif // _PreComp_
 #endif
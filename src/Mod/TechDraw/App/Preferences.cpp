@@ -438,6 +438,19 @@ int Preferences::scrubCount()
     return getPreferenceGroup("General")->GetInt("ScrubCount", 1);
 }
 
+//! maximum number of views processed (HLR, face finding, ...) at the same time. 0 means
+//! one per core.
+int Preferences::maxConcurrentViews()
+{
+    return getPreferenceGroup("General")->GetInt("MaxConcurrentViews", 0);
+}
+
+//! true if solids that can't hide each other are given to separate HLR runs
+bool Preferences::splitHlr()
+{
+    return getPreferenceGroup("General")->GetBool("SplitHlr", true);
+}
+
 //! Returns the factor for the overlap of svg tiles when hatching faces
 double Preferences::svgHatchFactor()
 {
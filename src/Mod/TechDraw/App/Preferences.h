@@ -108,6 +108,8 @@ public:
 
     static bool autoCorrectDimRefs();
     static int scrubCount();
+    static int maxConcurrentViews();
+    static bool splitHlr();
 
     static double svgHatchFactor();
     static bool SectionUsePreviousCut();
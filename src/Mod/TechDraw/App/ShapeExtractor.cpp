@@ -27,6 +27,7 @@
 # include <BRep_Builder.hxx>
 # include <Mod/Part/App/FCBRepAlgoAPI_Fuse.h>
 # include <BRepTools.hxx>
+# include <gp_Trsf.hxx>
 # include <TopoDS.hxx>
 # include <TopoDS_Iterator.hxx>
 # include <TopoDS_Vertex.hxx>
@@ -34,6 +35,9 @@
 #include <BRepCheck_Analyzer.hxx>
 #endif
 
+#include <list>
+#include <mutex>
+
 #include <App/Document.h>
 #include <App/GroupExtension.h>
 #include <App/FeaturePythonPyImp.h>
@@ -60,6 +64,75 @@ using namespace Measure;
 using DU = DrawUtil;
 using SU = ShapeUtils;
 
+namespace
+{
+//! Remembers the last fused source shapes, so that the views of the same sources (e.g. the
+//! views of a projection group or several sections of one part) share one fuse operation.
+//! A source is identified by its TShape, orientation and transformation. The location itself
+//! can't be compared, as getLocatedShape makes a new one on every call. A modified source
+//! object has a new TShape, and the entries keep their TShapes alive, so an entry can't be
+//! matched by an unrelated shape.
+class FusedShapeCache
+{
+public:
+    static FusedShapeCache& instance()
+    {
+        static FusedShapeCache cache;
+        return cache;
+    }
+
+    bool find(const std::vector<TopoDS_Shape>& sources, TopoDS_Shape& fused)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (isSame(it->first, sources)) {
+                entries.splice(entries.begin(), entries, it);
+                fused = entries.front().second;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void insert(const std::vector<TopoDS_Shape>& sources, const TopoDS_Shape& fused)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.emplace_front(sources, fused);
+        if (entries.size() > maxEntries) {
+            entries.pop_back();
+        }
+    }
+
+private:
+    static bool isSame(const std::vector<TopoDS_Shape>& s1, const std::vector<TopoDS_Shape>& s2)
+    {
+        return std::equal(s1.begin(), s1.end(), s2.begin(), s2.end(),
+                          [](const TopoDS_Shape& a, const TopoDS_Shape& b) {
+                              return a.TShape() == b.TShape()
+                                  && a.Orientation() == b.Orientation()
+                                  && isSame(a.Location().Transformation(),
+                                            b.Location().Transformation());
+                          });
+    }
+
+    static bool isSame(const gp_Trsf& t1, const gp_Trsf& t2)
+    {
+        for (int row = 1; row <= 3; row++) {
+            for (int col = 1; col <= 4; col++) {
+                if (t1.Value(row, col) != t2.Value(row, col)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    std::mutex mutex;
+    std::list<std::pair<std::vector<TopoDS_Shape>, TopoDS_Shape>> entries;
+    const std::size_t maxEntries = 8;
+};
+}
+
 
 //! pick out the 2d document objects in the list of links and return a vector of their shapes
 //! Note that point objects will not make it through the hlr/projection process.
@@ -353,18 +426,23 @@ TopoDS_Shape ShapeExtractor::getShapesFused(const std::vector<App::DocumentObjec
     // get only the 3d shapes and fuse them
     TopoDS_Shape baseShape = getShapes(links, false);
     if (!baseShape.IsNull()) {
-        TopoDS_Iterator it(baseShape);
-        TopoDS_Shape fusedShape = it.Value();
-        it.Next();
-        for (; it.More(); it.Next()) {
-            const TopoDS_Shape& aChild = it.Value();
-            FCBRepAlgoAPI_Fuse mkFuse(fusedShape, aChild);
-            // Let's check if the fusion has been successful
-            if (!mkFuse.IsDone()) {
-                Base::Console().Error("SE - Fusion failed\n");
-                return baseShape;
+        std::vector<TopoDS_Shape> sources;
+        for (TopoDS_Iterator it(baseShape); it.More(); it.Next()) {
+            sources.push_back(it.Value());
+        }
+        TopoDS_Shape fusedShape;
+        if (!FusedShapeCache::instance().find(sources, fusedShape)) {
+            fusedShape = sources.front();
+            for (std::size_t i = 1; i < sources.size(); i++) {
+                FCBRepAlgoAPI_Fuse mkFuse(fusedShape, sources[i]);
+                // Let's check if the fusion has been successful
+                if (!mkFuse.IsDone()) {
+                    Base::Console().Error("SE - Fusion failed\n");
+                    return baseShape;
+                }
+                fusedShape = mkFuse.Shape();
             }
-            fusedShape = mkFuse.Shape();
+            FusedShapeCache::instance().insert(sources, fusedShape);
         }
         baseShape = fusedShape;
     }
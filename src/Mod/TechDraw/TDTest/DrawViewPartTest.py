@@ -50,5 +50,113 @@ class DrawViewPartTest(unittest.TestCase):
         self.assertEqual(len(edges), 4, "DrawViewPart has wrong number of edges")
         self.assertTrue("Up-to-date" in view.State, "DrawViewPart is not Up-to-date")
 
+    def testSplitHlr(self):
+        """Tests if solids projected in separate HLR runs give the same edges as a single run"""
+        print("testing DrawViewPart split HLR")
+        box2 = FreeCAD.ActiveDocument.addObject("Part::Box", "Box2")
+        # moved perpendicular to the view direction, so the boxes can't hide each other
+        box2.Placement.Base = FreeCAD.Vector(100, -100, 0)
+        view = FreeCAD.ActiveDocument.addObject("TechDraw::DrawViewPart", "View")
+        self.page.addView(view)
+        view.Direction = FreeCAD.Vector(1, 1, 1)
+        view.HardHidden = True
+        view.Source = [FreeCAD.ActiveDocument.Box, box2]
+
+        hGrp = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/TechDraw/General")
+        splitHlr = hGrp.GetBool("SplitHlr", True)
+        try:
+            hGrp.SetBool("SplitHlr", False)
+            single = self._projectEdges(view)
+            hGrp.SetBool("SplitHlr", True)
+            split = self._projectEdges(view)
+        finally:
+            hGrp.SetBool("SplitHlr", splitHlr)
+
+        self.assertEqual(len(single[0]), 18, "DrawViewPart has wrong number of visible edges")
+        self.assertEqual(len(single[1]), 6, "DrawViewPart has wrong number of hidden edges")
+        self.assertEqual(split, single, "split HLR differs from single HLR")
+
+    def testFindFacesOverlappingEdges(self):
+        """Tests the faces found in a view where many projected edges overlap"""
+        print("testing DrawViewPart faces with overlapping edges")
+        # two rows of touching boxes, the second one shifted by half a box. In the top view the
+        # shared sides of the boxes overlap and the rows meet in T junctions.
+        boxes = []
+        for row in range(2):
+            for column in range(5):
+                box = FreeCAD.ActiveDocument.addObject("Part::Box", "Grid")
+                box.Placement.Base = FreeCAD.Vector(10 * column + 5 * row, 10 * row, 0)
+                boxes.append(box)
+        view = FreeCAD.ActiveDocument.addObject("TechDraw::DrawViewPart", "View")
+        self.page.addView(view)
+        view.ScaleType = "Custom"
+        view.Scale = 1.0
+        view.ScrubCount = 1
+        view.Source = boxes
+
+        hGrp = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/TechDraw/General")
+        newFaceFinder = hGrp.GetBool("NewFaceFinder", False)
+        try:
+            hGrp.SetBool("NewFaceFinder", False)
+            oldFaces = self._projectFaces(view)
+            hGrp.SetBool("NewFaceFinder", True)
+            newFaces = self._projectFaces(view)
+        finally:
+            hGrp.SetBool("NewFaceFinder", newFaceFinder)
+
+        self.assertEqual(len(oldFaces), 10, "DrawViewPart has wrong number of faces")
+        for area, x, y in oldFaces:
+            self.assertAlmostEqual(area, 100.0, 3, "DrawViewPart has a face with wrong area")
+        self.assertEqual(newFaces, oldFaces, "face finders give different faces")
+
+    def _projectFaces(self, view):
+        """recomputes the view and returns the sorted area and center of its faces"""
+        view.touch()
+        FreeCAD.ActiveDocument.recompute()
+
+        #wait for threads to complete before checking result
+        loop = QtCore.QEventLoop()
+
+        timer = QtCore.QTimer()
+        timer.setSingleShot(True)
+        timer.timeout.connect(loop.quit)
+
+        timer.start(2000)   #2 second delay
+        loop.exec_()
+
+        self.assertTrue("Up-to-date" in view.State, "DrawViewPart is not Up-to-date")
+
+        result = []
+        for face in view.getFaces():
+            center = face.CenterOfMass
+            result.append((round(face.Area, 3), round(center.x, 3), round(center.y, 3)))
+        return sorted(result)
+
+    def _projectEdges(self, view):
+        """recomputes the view and returns the sorted geometry of its visible and hidden edges"""
+        view.touch()
+        FreeCAD.ActiveDocument.recompute()
+
+        #wait for threads to complete before checking result
+        loop = QtCore.QEventLoop()
+
+        timer = QtCore.QTimer()
+        timer.setSingleShot(True)
+        timer.timeout.connect(loop.quit)
+
+        timer.start(2000)   #2 second delay
+        loop.exec_()
+
+        self.assertTrue("Up-to-date" in view.State, "DrawViewPart is not Up-to-date")
+
+        def describe(edges):
+            result = []
+            for edge in edges:
+                center = edge.BoundBox.Center
+                result.append((round(edge.Length, 6), round(center.x, 6), round(center.y, 6)))
+            return sorted(result)
+
+        return describe(view.getVisibleEdges()), describe(view.getHiddenEdges())
+
 if __name__ == "__main__":
     unittest.main()
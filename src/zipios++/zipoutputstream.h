@@ -54,6 +54,10 @@ public:
   */
   void putNextEntry(const std::string& entryName);
 
+  /** Writes an entry with already compressed content.
+      @see ZipOutputStreambuf::putRawEntry() */
+  void putRawEntry( const ZipCDirEntry &entry, const char *data ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const std::string& comment ) ;
 
@@ -49,6 +49,12 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Writes an entry whose content has already been compressed (or is
+      stored). The method, crc, size and compressed size of \a entry must be
+      set by the caller and \a data must hold exactly compressed size bytes.
+      The current entry is closed first. */
+  void putRawEntry( const ZipCDirEntry &entry, const char *data ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 
@@ -68,6 +74,7 @@ protected:
 
   void setEntryClosedState() ;
   void updateEntryHeaderInfo() ;
+  static int currentDosTime() ;
 
   // Should/could be moved to zipheadio.h ?!
   static void writeCentralDirectory( const vector< ZipCDirEntry > &entries, 
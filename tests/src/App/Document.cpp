@@ -3,8 +3,11 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <set>
+
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/DocumentObject.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -94,4 +97,119 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, undoLimitDropsOldestTransactions)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    doc()->setUndoLimit(1);
+    for (int i = 0; i < 3; ++i) {
+        doc()->openTransaction("add");
+        doc()->addObject("App::DocumentObjectGroup");
+        doc()->commitTransaction();
+    }
+
+    // Act
+    auto undos = doc()->getAvailableUndos();
+
+    // Assert
+    EXPECT_EQ(undos, 1);
+    EXPECT_GT(doc()->getUndoMemSize(), 0U);
+}
+
+TEST_F(DocumentTest, batchChangesCoalescesNotifications)
+{
+    // Arrange
+    auto obj = doc()->addObject("App::DocumentObjectGroup");
+    int labelChanges = 0;
+    auto connection = doc()->signalChangedObject.connect(
+        [&labelChanges, obj](const App::DocumentObject& changed, const App::Property& prop) {
+            if (&changed == obj && &prop == &obj->Label) {
+                ++labelChanges;
+            }
+        });
+
+    // Act
+    doc()->beginBatchChanges();
+    obj->Label.setValue("first");
+    obj->Label.setValue("second");
+    int changesWhileBatching = labelChanges;
+    doc()->endBatchChanges();
+
+    // Assert
+    EXPECT_EQ(changesWhileBatching, 0);
+    EXPECT_EQ(labelChanges, 1);
+    connection.disconnect();
+}
+
+TEST_F(DocumentTest, addObjectsCreatesUniqueNames)
+{
+    // Arrange
+    doc()->addObject("App::DocumentObjectGroup", "Box");
+
+    // Act
+    auto objs = doc()->addObjects("App::DocumentObjectGroup", {"Box", "Box", "Box005", ""});
+    doc()->removeObject("Box005");
+
+    // Assert
+    ASSERT_EQ(objs.size(), 4);
+    EXPECT_STREQ(objs[0]->getNameInDocument(), "Box001");
+    EXPECT_STREQ(objs[1]->getNameInDocument(), "Box002");
+    EXPECT_STREQ(objs[2]->getNameInDocument(), "Box005");
+    EXPECT_STREQ(objs[3]->getNameInDocument(), "App__DocumentObjectGroup");
+    EXPECT_EQ(doc()->getUniqueObjectName("Box"), "Box003");
+}
+
+TEST_F(DocumentTest, duplicateLabelFollowsRenameAndRemove)
+{
+    // Arrange
+    auto first = doc()->addObject("App::DocumentObjectGroup", "First");
+    auto second = doc()->addObject("App::DocumentObjectGroup", "Second");
+    std::string firstName = first->getNameInDocument();
+
+    // Act
+    first->Label.setValue("Name");
+    second->Label.setValue("Name");
+    std::string duplicate = second->Label.getStrValue();
+    first->Label.setValue("Free");
+    second->Label.setValue("Name");
+    doc()->removeObject(firstName.c_str());
+    auto third = doc()->addObject("App::DocumentObjectGroup", "Third");
+    third->Label.setValue("Free");
+
+    // Assert
+    EXPECT_EQ(duplicate, "Name001");
+    EXPECT_EQ(second->Label.getStrValue(), "Name");
+    EXPECT_EQ(third->Label.getStrValue(), "Free");
+    EXPECT_TRUE(doc()->containsLabel("Name"));
+    EXPECT_FALSE(doc()->containsLabel("First"));
+}
+
+TEST_F(DocumentTest, addObjectsKeepsManyCollidingNamesUnique)
+{
+    // Arrange
+    const std::size_t count = 1000;
+    doc()->addObject("App::DocumentObjectGroup", "Box005");
+    std::vector<std::string> names(count, "Box");
+
+    // Act
+    auto objs = doc()->addObjects("App::DocumentObjectGroup", names);
+    for (auto obj : objs) {
+        obj->Label.setValue("Box");
+    }
+
+    // Assert
+    ASSERT_EQ(objs.size(), count);
+    std::set<std::string> uniqueNames {"Box005"};
+    std::set<std::string> uniqueLabels {"Box005"};
+    for (auto obj : objs) {
+        uniqueNames.insert(obj->getNameInDocument());
+        uniqueLabels.insert(obj->Label.getStrValue());
+    }
+    EXPECT_EQ(uniqueNames.size(), count + 1);
+    EXPECT_EQ(uniqueLabels.size(), count + 1);
+    EXPECT_STREQ(objs[0]->getNameInDocument(), "Box");
+    EXPECT_EQ(objs[0]->Label.getStrValue(), "Box");
+    EXPECT_TRUE(doc()->containsLabel("Box"));
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -9,6 +9,7 @@
 #include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/GeoFeatureGroupExtension.h>
+#include <App/PropertyLinks.h>
 #include <Base/Interpreter.h>
 
 using namespace App;
@@ -155,4 +156,34 @@ TEST_F(DocumentObjectTest, getSubObjectList)
     EXPECT_EQ(sizesFlatten[1], strlen(fuseName) + strlen(boxName) + 2);
 }
 
+TEST_F(DocumentObjectTest, recursiveListsFollowLinkChanges)
+{
+    // Arrange
+    auto top {_doc->addObject("App::DocumentObjectGroup")};
+    auto middle {_doc->addObject("App::DocumentObjectGroup")};
+    auto bottom {_doc->addObject("App::DocumentObjectGroup")};
+    auto topGroup {dynamic_cast<App::PropertyLinkList*>(top->getPropertyByName("Group"))};
+    auto middleGroup {dynamic_cast<App::PropertyLinkList*>(middle->getPropertyByName("Group"))};
+    topGroup->setValues({middle});
+    middleGroup->setValues({bottom});
+
+    // Act
+    bool linkedBefore {bottom->isInInListRecursive(top)};
+    bool dagBefore {bottom->testIfLinkDAGCompatible(top)};
+    auto outListBefore {top->getOutListRecursive()};
+    topGroup->setValues({});
+    bool linkedAfter {bottom->isInInListRecursive(top)};
+    bool dagAfter {bottom->testIfLinkDAGCompatible(top)};
+    auto outListAfter {top->getOutListRecursive()};
+
+    // Assert
+    EXPECT_TRUE(linkedBefore);
+    EXPECT_FALSE(dagBefore);
+    EXPECT_EQ(outListBefore.size(), 2);
+    EXPECT_FALSE(linkedAfter);
+    EXPECT_TRUE(dagAfter);
+    EXPECT_TRUE(outListAfter.empty());
+    EXPECT_EQ(bottom->getInListRecursive(), std::vector<DocumentObject*> {middle});
+}
+
 // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
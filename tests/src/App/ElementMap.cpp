@@ -266,6 +266,26 @@ TEST_F(ElementMapTest, findMappedName)
     EXPECT_EQ(findResult2, element2);
 }
 
+TEST_F(ElementMapTest, findMappedNameWithPostfix)
+{
+    // Arrange
+    // Names are equal if the concatenation of data and postfix is equal, no
+    // matter where the postfix starts
+    Data::ElementMap elementMap;
+
+    Data::IndexedName element("Edge", 1);
+    Data::MappedName mappedName(Data::MappedName("TEST"), "POSTFIX");
+    elementMap.setElementName(element, mappedName, 0);
+
+    // Act
+    auto findResult = elementMap.find(Data::MappedName(Data::MappedName("TESTPOST"), "FIX"));
+    auto findResult2 = elementMap.find(Data::MappedName("TESTPOSTFIX"));
+
+    // Assert
+    EXPECT_EQ(findResult, element);
+    EXPECT_EQ(findResult2, element);
+}
+
 TEST_F(ElementMapTest, findIndexedName)
 {
     // Arrange
@@ -8,6 +8,8 @@
 #include "App/Expression.h"
 #include "App/ExpressionParser.h"
 
+#include "Base/Interpreter.h"
+
 #include "src/App/InitApplication.h"
 
 // clang-format off
@@ -117,4 +119,32 @@ TEST_F(ExpressionParserTest, isTokenAConstant)
     }
 }
 
+TEST_F(ExpressionParserTest, numericValueMatchesPythonValue)
+{
+    std::array<std::string, 10> expressions {
+        "1 + 2", "7 / 2", "2 * 3.5", "-4", "+4.5", "10 mm + 2 mm",
+        "10 mm * 2", "1 m / 1 mm", "pi * 2", "-(3 mm)"};
+    for (const auto & text : expressions) {
+        std::unique_ptr<App::Expression> expression(App::ExpressionParser::parse(this_obj(), text.c_str()));
+        App::NumericValue value;
+        ASSERT_TRUE(expression->getNumericValue(value)) << text;
+
+        auto native = expression->getValueAsAny();
+        Base::PyGILStateLocker lock;
+        auto python = App::pyObjectToAny(expression->getPyValue());
+        EXPECT_EQ(native.type(), python.type()) << text;
+        EXPECT_TRUE(App::isAnyEqual(native, python)) << text;
+    }
+}
+
+TEST_F(ExpressionParserTest, numericValueFallsBackToPython)
+{
+    std::array<std::string, 4> expressions {"1 mm + 1 s", "1 / 0", "2 ^ 3", "1 < 2"};
+    for (const auto & text : expressions) {
+        std::unique_ptr<App::Expression> expression(App::ExpressionParser::parse(this_obj(), text.c_str()));
+        App::NumericValue value;
+        EXPECT_FALSE(expression->getNumericValue(value)) << text;
+    }
+}
+
 // clang-format on
@@ -9,6 +9,9 @@
 
 #include <QCryptographicHash>
 #include <array>
+#include <string>
+#include <thread>
+#include <vector>
 
 class StringIDTest: public ::testing::Test
 {
@@ -1586,3 +1589,31 @@ TEST_F(StringHasherTest, compact)  // NOLINT
     // Assert
     EXPECT_EQ(0, Hasher()->count());
 }
+
+TEST_F(StringHasherTest, getIDConcurrently)  // NOLINT
+{
+    // Arrange
+    const int numThreads = 4;
+    const int numStrings = 200;
+    std::vector<std::vector<long>> ids(numThreads);
+    std::vector<std::thread> threads;
+
+    // Act
+    for (int i = 0; i < numThreads; ++i) {
+        threads.emplace_back([this, &ids, i]() {
+            for (int j = 0; j < numStrings; ++j) {
+                auto text = std::string("name") + std::to_string(j);
+                ids[i].push_back(Hasher()->getID(text.c_str()).value());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    EXPECT_EQ(numStrings, Hasher()->size());
+    for (int i = 1; i < numThreads; ++i) {
+        EXPECT_EQ(ids[0], ids[i]);
+    }
+}
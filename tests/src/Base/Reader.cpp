@@ -11,6 +11,7 @@
 #include <array>
 #include <boost/filesystem.hpp>
 #include <fstream>
+#include <vector>
 #include <xercesc/util/PlatformUtils.hpp>
 
 namespace fs = boost::filesystem;
@@ -368,3 +369,49 @@ TEST_F(ReaderTest, invalidDefaults)
         { xml.Reader()->getAttributeAsInteger("missing", "Not a Float"); },
         std::invalid_argument);
 }
+
+TEST_F(ReaderTest, attributesOfPreviousElementAreDropped)
+{
+    // Arrange
+    ReaderXML xml;
+    xml.givenDataAsXMLStream("<first a='1' b='2' c='3'/><second b='äöü'/>");
+    xml.Reader()->readElement("first");
+    EXPECT_EQ(xml.Reader()->getAttributeCount(), 3U);
+
+    // Act
+    xml.Reader()->readElement("second");
+
+    // Assert
+    EXPECT_EQ(xml.Reader()->getAttributeCount(), 1U);
+    EXPECT_FALSE(xml.Reader()->hasAttribute("a"));
+    EXPECT_FALSE(xml.Reader()->hasAttribute("c"));
+    EXPECT_STREQ(xml.Reader()->getAttribute("b"), "äöü");
+}
+
+TEST(DecodeTaskQueueTest, applyInOrder)
+{
+    // Arrange
+    std::vector<int> decoded(20, 0);
+    std::vector<int> applied;
+    {
+        Base::DecodeTaskQueue queue;
+
+        // Act
+        for (int i = 0; i < static_cast<int>(decoded.size()); ++i) {
+            queue.add(
+                [&decoded, i]() {
+                    decoded[i] = i * i;
+                },
+                [&decoded, &applied, i]() {
+                    applied.push_back(decoded[i]);
+                });
+        }
+        queue.applyAll();
+    }
+
+    // Assert
+    ASSERT_EQ(applied.size(), decoded.size());
+    for (int i = 0; i < static_cast<int>(applied.size()); ++i) {
+        EXPECT_EQ(applied[i], i * i);
+    }
+}
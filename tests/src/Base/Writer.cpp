@@ -2,7 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Writer.h"
 
 // Writer is designed to be a base class, so for testing we actually instantiate a StringWriter,
@@ -129,3 +134,67 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+namespace
+{
+class DocFile: public Base::Persistence
+{
+public:
+    explicit DocFile(std::string content)
+        : content(std::move(content))
+    {}
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(content.size());
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << content;
+    }
+
+private:
+    std::string content;
+};
+}  // namespace
+
+TEST(ZipWriterTest, writeFilesParallel)
+{
+    // Arrange
+    std::vector<DocFile> files {DocFile(std::string(10000, 'a')),
+                                DocFile("short"),
+                                DocFile(std::string("\x89PNG\r\n", 6))};
+    std::vector<std::string> names {"a.txt", "b.txt", "c.png"};
+    std::stringstream zip;
+
+    // Act
+    {
+        Base::ZipWriter writer(zip);
+        writer.setParallel(true);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            writer.addFile(names[i].c_str(), &files[i]);
+        }
+        writer.writeFiles();
+    }
+
+    // Assert
+    zip.seekg(0);
+    // The first entry is opened by the constructor
+    zipios::ZipInputStream reader(zip);
+    std::ostringstream document;
+    document << reader.rdbuf();
+    EXPECT_EQ(document.str(), "<Document/>");
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        auto entry = reader.getNextEntry();
+        ASSERT_TRUE(entry->isValid());
+        EXPECT_EQ(entry->getName(), names[i]);
+        std::ostringstream content;
+        content << reader.rdbuf();
+        EXPECT_EQ(content.str().size(), files[i].getMemSize());
+    }
+}
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <src/App/InitApplication.h>
+#include <App/Document.h>
+#include <Mod/Fem/App/FemPostFilter.h>
+#include <Mod/Fem/App/FemPostFunction.h>
+#include <Mod/Fem/App/FemPostPipeline.h>
+#include <vtkCellType.h>
+#include <vtkDataObject.h>
+#include <vtkDataSet.h>
+#include <vtkPoints.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+class FemPostFilterTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _pipeline = dynamic_cast<Fem::FemPostPipeline*>(_doc->addObject("Fem::FemPostPipeline"));
+        _pipeline->Data.setValue(makeGrid());
+        _plane = dynamic_cast<Fem::FemPostPlaneFunction*>(
+            _doc->addObject("Fem::FemPostPlaneFunction"));
+        _plane->Normal.setValue(Base::Vector3d(1.0, 0.0, 0.0));
+        _plane->Origin.setValue(Base::Vector3d(0.5, 0.0, 0.0));
+        _clip = dynamic_cast<Fem::FemPostClipFilter*>(_doc->addObject("Fem::FemPostClipFilter"));
+        _clip->Input.setValue(_pipeline);
+        _clip->Function.setValue(_plane);
+        _doc->recompute();
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    //! two hexahedrons side by side along the x axis
+    static vtkSmartPointer<vtkUnstructuredGrid> makeGrid()
+    {
+        vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+        for (int z = 0; z < 2; z++) {
+            for (int y = 0; y < 2; y++) {
+                for (int x = 0; x < 3; x++) {
+                    points->InsertNextPoint(x, y, z);
+                }
+            }
+        }
+        vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+        grid->SetPoints(points);
+        grid->Allocate(2);
+        for (vtkIdType x = 0; x < 2; x++) {
+            vtkIdType ids[8] = {x, x + 1, x + 4, x + 3, x + 6, x + 7, x + 10, x + 9};
+            grid->InsertNextCell(VTK_HEXAHEDRON, 8, ids);
+        }
+        return grid;
+    }
+
+    static vtkIdType numberOfCells(vtkDataObject* data)
+    {
+        return vtkDataSet::SafeDownCast(data)->GetNumberOfCells();
+    }
+
+    App::Document* _doc {};
+    std::string _docName;
+    Fem::FemPostPipeline* _pipeline {};
+    Fem::FemPostPlaneFunction* _plane {};
+    Fem::FemPostClipFilter* _clip {};
+};
+
+TEST_F(FemPostFilterTest, unchangedPipelineKeepsData)
+{
+    // Arrange
+    // keeps the object alive, so its address can't be reused by a new one
+    vtkSmartPointer<vtkDataObject> data = _clip->Data.getValue();
+    ASSERT_NE(data.GetPointer(), nullptr);
+
+    // Act
+    _pipeline->touch();
+    _clip->touch();
+    _doc->recompute();
+
+    // Assert
+    EXPECT_EQ(_clip->Data.getValue().GetPointer(), data.GetPointer());
+}
+
+TEST_F(FemPostFilterTest, changedClipFunctionReplacesData)
+{
+    // Arrange
+    vtkSmartPointer<vtkDataObject> data = _clip->Data.getValue();
+    ASSERT_NE(data.GetPointer(), nullptr);
+    vtkIdType cells = numberOfCells(data);
+
+    // Act
+    _plane->Origin.setValue(Base::Vector3d(-1.0, 0.0, 0.0));
+    _doc->recompute();
+
+    // Assert
+    EXPECT_NE(_clip->Data.getValue().GetPointer(), data.GetPointer());
+    EXPECT_NE(numberOfCells(_clip->Data.getValue()), cells);
+}
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
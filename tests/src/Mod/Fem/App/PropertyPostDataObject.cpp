@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <src/App/InitApplication.h>
+#include <App/Document.h>
+#include <Mod/Fem/App/FemPostPipeline.h>
+#include <Mod/Fem/App/PropertyPostDataObject.h>
+#include <vtkCellType.h>
+#include <vtkDataArray.h>
+#include <vtkDataSet.h>
+#include <vtkDoubleArray.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+class PropertyPostDataObjectTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _doc->setUndoMode(1);
+        _source = makeGrid();
+        _pipeline = dynamic_cast<Fem::FemPostPipeline*>(_doc->addObject("Fem::FemPostPipeline"));
+        // the pipeline shares the points and arrays of the source, like the output of a reader
+        _pipeline->Data.setValue(_source);
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    //! a single tetrahedron with a displacement field
+    static vtkSmartPointer<vtkUnstructuredGrid> makeGrid()
+    {
+        vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+        points->InsertNextPoint(0.0, 0.0, 0.0);
+        points->InsertNextPoint(1.0, 0.0, 0.0);
+        points->InsertNextPoint(0.0, 1.0, 0.0);
+        points->InsertNextPoint(0.0, 0.0, 1.0);
+
+        vtkSmartPointer<vtkDoubleArray> displacement = vtkSmartPointer<vtkDoubleArray>::New();
+        displacement->SetName("Displacement");
+        displacement->SetNumberOfComponents(3);
+        for (vtkIdType i = 0; i < 4; i++) {
+            displacement->InsertNextTuple3(i, 2.0 * i, 3.0 * i);
+        }
+
+        vtkSmartPointer<vtkUnstructuredGrid> grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+        grid->SetPoints(points);
+        vtkIdType ids[4] = {0, 1, 2, 3};
+        grid->InsertNextCell(VTK_TETRA, 4, ids);
+        grid->GetPointData()->AddArray(displacement);
+        return grid;
+    }
+
+    static vtkDataSet* dataSet(const Fem::PropertyPostDataObject& prop)
+    {
+        return vtkDataSet::SafeDownCast(prop.getValue());
+    }
+
+    //! expects the points of data to be the points of the source grid times factor
+    static void expectPoints(vtkDataSet* data, double factor)
+    {
+        ASSERT_EQ(data->GetNumberOfPoints(), 4);
+        vtkSmartPointer<vtkUnstructuredGrid> original = makeGrid();
+        for (vtkIdType i = 0; i < 4; i++) {
+            double expected[3];
+            double actual[3];
+            original->GetPoint(i, expected);
+            data->GetPoint(i, actual);
+            for (int j = 0; j < 3; j++) {
+                EXPECT_DOUBLE_EQ(actual[j], expected[j] * factor);
+            }
+        }
+    }
+
+    //! expects the displacement field of data to be the one of the source grid times factor
+    static void expectDisplacement(vtkDataSet* data, double factor)
+    {
+        vtkDataArray* array = data->GetPointData()->GetArray("Displacement");
+        ASSERT_NE(array, nullptr);
+        for (vtkIdType i = 0; i < 4; i++) {
+            EXPECT_DOUBLE_EQ(array->GetComponent(i, 0), i * factor);
+            EXPECT_DOUBLE_EQ(array->GetComponent(i, 1), 2.0 * i * factor);
+            EXPECT_DOUBLE_EQ(array->GetComponent(i, 2), 3.0 * i * factor);
+        }
+    }
+
+    App::Document* _doc {};
+    std::string _docName;
+    vtkSmartPointer<vtkUnstructuredGrid> _source;
+    Fem::FemPostPipeline* _pipeline {};
+};
+
+TEST_F(PropertyPostDataObjectTest, scaleKeepsSharedPoints)
+{
+    // Act
+    _doc->openTransaction("Scale");
+    _pipeline->scale(1000.0);
+    _doc->commitTransaction();
+
+    // Assert
+    expectPoints(dataSet(_pipeline->Data), 1000.0);
+    expectPoints(_source, 1.0);
+}
+
+TEST_F(PropertyPostDataObjectTest, undoScaleRestoresPoints)
+{
+    // Arrange
+    _doc->openTransaction("Scale");
+    _pipeline->scale(1000.0);
+    _doc->commitTransaction();
+
+    // Act
+    _doc->undo();
+
+    // Assert
+    expectPoints(dataSet(_pipeline->Data), 1.0);
+    expectPoints(_source, 1.0);
+}
+
+TEST_F(PropertyPostDataObjectTest, copyIsNotScaled)
+{
+    // Arrange
+    std::unique_ptr<App::Property> copy(_pipeline->Data.Copy());
+
+    // Act
+    _pipeline->scale(1000.0);
+
+    // Assert
+    expectPoints(dataSet(_pipeline->Data), 1000.0);
+    expectPoints(dataSet(static_cast<Fem::PropertyPostDataObject&>(*copy)), 1.0);
+}
+
+TEST_F(PropertyPostDataObjectTest, scaleFieldKeepsSharedArray)
+{
+    // Arrange
+    std::unique_ptr<App::Property> copy(_pipeline->Data.Copy());
+    vtkDataSet* data = dataSet(_pipeline->Data);
+
+    // Act
+    Fem::FemPostPipeline::scaleField(data,
+                                     data->GetPointData()->GetArray("Displacement"),
+                                     10.0);
+
+    // Assert
+    expectDisplacement(data, 10.0);
+    expectDisplacement(dataSet(static_cast<Fem::PropertyPostDataObject&>(*copy)), 1.0);
+    expectDisplacement(_source, 1.0);
+}
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 
 #include <BRepFilletAPI_MakeFillet.hxx>
+#include <Base/Reader.h>
+#include <Base/Writer.h>
 #include "Mod/Part/App/FeaturePartCommon.h"
 #include "Mod/Part/App/PropertyTopoShape.h"
 #include <src/App/InitApplication.h>
@@ -252,6 +254,32 @@ TEST_F(PropertyTopoShapeTest, testPropertyShapeCachePyObj)
     Py_XDECREF(pyObjOutErased);
 }
 
+TEST_F(PropertyTopoShapeTest, testSaveRestoreInline)
+{
+    for (bool binary : {true, false}) {
+        // Arrange
+        Part::PropertyPartShape propIn;
+        propIn.setValue(_boxes[0]->Shape.getShape());
+        Base::StringWriter writer;
+        writer.setForceXML(true);
+        if (binary) {
+            writer.setMode("BinaryBrep");
+        }
+        writer.Stream() << "<Test>\n";
+        propIn.Save(writer);
+        writer.Stream() << "</Test>\n";
+        // Act
+        std::stringstream str(writer.getString());
+        Base::XMLReader reader("Document.xml", str);
+        Part::PropertyPartShape propOut;
+        propOut.Restore(reader);
+        // Assert
+        EXPECT_TRUE(reader.isValid());
+        EXPECT_FALSE(propOut.getValue().IsNull());
+        EXPECT_DOUBLE_EQ(getVolume(propOut.getValue()), getVolume(propIn.getValue()));
+    }
+}
+
 TEST_F(PropertyTopoShapeTest, testRestore)
 {
     // Test case for https://github.com/FreeCAD/FreeCAD/pull/16576
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <BRepTools.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <Mod/Part/App/TessellationCache.h>
+#include <Mod/Part/App/TopoShape.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+class TessellationCacheTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Part::TessellationCache::instance().clear();
+    }
+
+    void TearDown() override
+    {
+        Part::TessellationCache::instance().clear();
+    }
+};
+
+TEST_F(TessellationCacheTest, tessellateBox)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+
+    // Act
+    auto tess = Part::TessellationCache::instance().getTessellation(box, 0.1, 0.1);
+
+    // Assert
+    EXPECT_EQ(tess->domains.size(), 6);
+    EXPECT_EQ(tess->segments.size(), 6);
+    EXPECT_EQ(tess->points.size(), 8);
+    EXPECT_EQ(tess->facets.size(), 12);
+}
+
+TEST_F(TessellationCacheTest, sharedPerDeflection)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    auto& cache = Part::TessellationCache::instance();
+
+    // Act
+    auto tess1 = cache.getTessellation(box, 0.1, 0.1);
+    auto tess2 = cache.getTessellation(box, 0.1, 0.1);
+    auto tess3 = cache.getTessellation(box, 0.2, 0.1);
+
+    // Assert
+    EXPECT_EQ(tess1, tess2);
+    EXPECT_NE(tess1, tess3);
+    EXPECT_EQ(cache.size(), 2);
+}
+
+TEST_F(TessellationCacheTest, getFacesUsesCache)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    Part::TopoShape shape(box);
+    std::vector<Base::Vector3d> points;
+    std::vector<Data::ComplexGeoData::Facet> facets;
+
+    // Act
+    shape.getFaces(points, facets, 0.1);
+
+    // Assert
+    EXPECT_EQ(points.size(), 8);
+    EXPECT_EQ(facets.size(), 12);
+    EXPECT_EQ(Part::TessellationCache::instance().size(), 1);
+}
+
+TEST_F(TessellationCacheTest, removeShape)
+{
+    // Arrange
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    auto& cache = Part::TessellationCache::instance();
+    cache.getTessellation(box, 0.1, 0.1);
+    cache.getTessellation(box, 0.2, 0.1);
+
+    // Act
+    BRepTools::Clean(box);
+    cache.remove(box);
+
+    // Assert
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST_F(TessellationCacheTest, maxEntries)
+{
+    // Arrange
+    auto& cache = Part::TessellationCache::instance();
+    std::size_t maxEntries = cache.getMaxEntries();
+    cache.setMaxEntries(2);
+
+    // Act
+    for (int i = 1; i <= 4; i++) {
+        TopoDS_Shape box = BRepPrimAPI_MakeBox(i, i, i).Shape();
+        cache.getTessellation(box, 0.1, 0.1);
+    }
+
+    // Assert
+    EXPECT_EQ(cache.size(), 2);
+    cache.setMaxEntries(maxEntries);
+}
+TEST_F(TessellationCacheTest, maxMemSize)
+{
+    // Arrange
+    auto& cache = Part::TessellationCache::instance();
+    std::size_t maxMemSize = cache.getMaxMemSize();
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape();
+    std::size_t boxSize = cache.getTessellation(box, 0.1, 0.1)->getMemSize();
+    cache.clear();
+    cache.setMaxMemSize(boxSize * 2);
+
+    // Act
+    for (int i = 1; i <= 4; i++) {
+        TopoDS_Shape shape = BRepPrimAPI_MakeBox(i, i, i).Shape();
+        cache.getTessellation(shape, 0.1, 0.1);
+    }
+
+    // Assert
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.getMemSize(), boxSize * 2);
+    cache.setMaxMemSize(maxMemSize);
+}
+
+TEST_F(TessellationCacheTest, remeshChangedDeflection)
+{
+    // Arrange
+    TopoDS_Shape sphere = BRepPrimAPI_MakeSphere(10.0).Shape();
+    auto& cache = Part::TessellationCache::instance();
+    cache.meshShape(sphere, 0.5, 0.5);
+    auto getDeflection = [&sphere]() {
+        TopLoc_Location loc;
+        TopExp_Explorer xp(sphere, TopAbs_FACE);
+        return BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc)->Deflection();
+    };
+
+    // Act
+    BRepMesh_IncrementalMesh(sphere, 0.01, Standard_False, 0.5, Standard_True);
+    double other = getDeflection();
+    cache.meshShape(sphere, 0.5, 0.5);
+
+    // Assert
+    EXPECT_NEAR(other, 0.01, 0.001);
+    EXPECT_NEAR(getDeflection(), 0.5, 0.05);
+}
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -1947,6 +1947,56 @@ TEST_F(TopoShapeExpansionTest, makeElementGeneralFuse)
                                  }));
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementFuseDeferredElementMap)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    auto tr {gp_Trsf()};
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.5, -0.5, 0)));
+    cube2.Move(TopLoc_Location(tr));
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    TopoShape eager {0L};
+    eager.makeElementFuse({topoShape1, topoShape2});
+    // Act
+    TopoShape::setElementMapDeferred(true);
+    TopoShape deferred {0L};
+    deferred.makeElementFuse({topoShape1, topoShape2});
+    TopoShape::setElementMapDeferred(false);
+    bool pending = deferred.hasPendingElementMap();
+    auto elements = elementMap(deferred);
+    // Assert
+    EXPECT_TRUE(pending);
+    EXPECT_FALSE(deferred.hasPendingElementMap());
+    EXPECT_EQ(elements.size(), 66);
+    EXPECT_EQ(elements, elementMap(eager));
+}
+
+TEST_F(TopoShapeExpansionTest, makeElementPrismDeferredElementMapMoved)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    TopoShape topoShape1 {cube1, 1L};
+    auto subTopoFaces = topoShape1.getSubTopoShapes(TopAbs_FACE);
+    subTopoFaces[0].Tag = 2L;
+    TopoShape eager {1L};
+    eager.makeElementPrism(subTopoFaces[0], {0.75, 0, 0});
+    TopoShape::setElementMapDeferred(true);
+    TopoShape deferred {1L};
+    deferred.makeElementPrism(subTopoFaces[0], {0.75, 0, 0});
+    TopoShape::setElementMapDeferred(false);
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(5.0, 0.0, 0.0));
+    // Act
+    deferred.setTransform(mat);
+    auto element = deferred.getElementName("Edge1;:G;XTR;:H2:7,F");
+    // Assert
+    EXPECT_FALSE(deferred.hasPendingElementMap());
+    EXPECT_STREQ(element.index.getType(), "Face");
+    EXPECT_EQ(element.index, eager.getElementName("Edge1;:G;XTR;:H2:7,F").index);
+    EXPECT_EQ(elementMap(deferred), elementMap(eager));
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementFuse)
 {
     // Arrange
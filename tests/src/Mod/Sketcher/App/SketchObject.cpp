@@ -1774,6 +1774,39 @@ TEST_F(SketchObjectTest, testJoinCurvesWhenTangent)
     }));
 }
 
+TEST_F(SketchObjectTest, testSolveAfterDatumChange)
+{
+    // Arrange
+    Base::Vector3d coords1(0.0, 0.0, 0.0);
+    Base::Vector3d coords2(3.0, 0.0, 0.0);
+    Part::GeomLineSegment lineSeg;
+    lineSeg.setPoints(coords1, coords2);
+    int geoId = getObject()->addGeometry(&lineSeg);
+
+    auto constraint = new Sketcher::Constraint();  // Ownership will be transferred to the sketch
+    constraint->Type = Sketcher::ConstraintType::Distance;
+    constraint->First = geoId;
+    constraint->setValue(3.0);
+    int constrId = getObject()->addConstraint(constraint);
+    getObject()->solve();
+
+    auto length = [this, geoId]() {
+        auto line = static_cast<const Part::GeomLineSegment*>(getObject()->getGeometry(geoId));
+        return (line->getEndPoint() - line->getStartPoint()).Length();
+    };
+
+    // Act
+    // only the datum changes, so the solver set up by the previous solve is kept
+    getObject()->setDatum(constrId, 5.0);
+    double firstLength = length();
+    getObject()->setDatum(constrId, 4.0);
+    double secondLength = length();
+
+    // Assert
+    EXPECT_NEAR(firstLength, 5.0, 1e-7);
+    EXPECT_NEAR(secondLength, 4.0, 1e-7);
+}
+
 TEST_F(SketchObjectTest, testReverseAngleConstraintToSupplementaryExpressionNoUnits1)
 {
     std::string expr = Sketcher::SketchObject::reverseAngleConstraintExpression("180 - 60");
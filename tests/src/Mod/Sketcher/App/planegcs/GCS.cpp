@@ -50,3 +50,94 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, solveDecoupledComponents)  // NOLINT
+{
+    // Arrange
+    // every pair of unknowns is linked by its own constraint only, so that there are
+    // enough decoupled components to be solved concurrently
+    const size_t numComponents {150};
+    std::vector<double> first(numComponents, 0.0);
+    std::vector<double> second(numComponents, 0.0);
+    std::vector<double> differences(numComponents);
+    std::vector<double*> params;
+    for (size_t i = 0; i < numComponents; ++i) {
+        differences[i] = static_cast<double>(i);
+        params.push_back(&first[i]);
+        params.push_back(&second[i]);
+        System()->addConstraintDifference(&first[i], &second[i], &differences[i], 1);
+    }
+
+    // Act
+    int result = System()->solve(params);
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(result, GCS::Success);
+    for (size_t i = 0; i < numComponents; ++i) {
+        EXPECT_NEAR(second[i] - first[i], differences[i], 1e-6);
+    }
+}
+
+TEST_F(GCSTest, diagnoseDecoupledComponents)  // NOLINT
+{
+    // Arrange
+    // two decoupled components, the first one with a redundant constraint
+    double a0 {0.0}, a1 {0.0}, b0 {0.0}, b1 {0.0}, difference {1.0};
+    std::vector<double*> params {&a0, &a1, &b0, &b1};
+    System()->addConstraintDifference(&a0, &a1, &difference, 1);
+    System()->addConstraintDifference(&a0, &a1, &difference, 2);
+    System()->addConstraintDifference(&b0, &b1, &difference, 3);
+    System()->declareUnknowns(params);
+
+    // Act
+    int dofs = System()->diagnose();
+    System()->invalidatedDiagnosis();
+    int dofsAgain = System()->diagnose();  // reuses the diagnosis of the unchanged components
+
+    // Assert
+    EXPECT_EQ(dofs, 2);
+    EXPECT_EQ(dofsAgain, 2);
+    GCS::VEC_I redundant;
+    System()->getRedundant(redundant);
+    EXPECT_EQ(redundant, GCS::VEC_I {2});
+    std::vector<std::vector<double*>> groups;
+    System()->getDependentParamsGroups(groups);
+    EXPECT_EQ(groups.size(), 2);
+}
+
+TEST_F(GCSTest, sparseGaussStepMatchesDense)  // NOLINT
+{
+    // Arrange
+    // a chain of unknowns, each one at a fixed distance from the previous one
+    const size_t numParams {100};
+    std::vector<double> dense(numParams), sparse(numParams);
+    std::vector<double> differences(numParams - 1);
+    std::vector<double*> denseParams, sparseParams;
+    SystemTest sparseSystem;
+    sparseSystem.dogLegGaussStep = GCS::LeastNormSparseLdlt;
+    System()->dogLegGaussStep = GCS::LeastNormLdlt;
+    for (size_t i = 0; i < numParams; ++i) {
+        dense[i] = sparse[i] = 0.5 * static_cast<double>(i);
+        denseParams.push_back(&dense[i]);
+        sparseParams.push_back(&sparse[i]);
+    }
+    for (size_t i = 0; i + 1 < numParams; ++i) {
+        differences[i] = 1.0 + 0.1 * static_cast<double>(i);
+        System()->addConstraintDifference(&dense[i], &dense[i + 1], &differences[i], 1);
+        sparseSystem.addConstraintDifference(&sparse[i], &sparse[i + 1], &differences[i], 1);
+    }
+
+    // Act
+    int denseResult = System()->solve(denseParams);
+    System()->applySolution();
+    int sparseResult = sparseSystem.solve(sparseParams);
+    sparseSystem.applySolution();
+
+    // Assert
+    EXPECT_EQ(denseResult, GCS::Success);
+    EXPECT_EQ(sparseResult, GCS::Success);
+    for (size_t i = 0; i < numParams; ++i) {
+        EXPECT_NEAR(sparse[i], dense[i], 1e-8);
+    }
+}
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
+#include <src/App/InitApplication.h>
+#include <App/Document.h>
+#include <Base/Placement.h>
+#include <Mod/Part/App/PrimitiveFeature.h>
+#include <Mod/TechDraw/App/ShapeExtractor.h>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+class ShapeExtractorTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _box1 = dynamic_cast<Part::Box*>(_doc->addObject("Part::Box"));
+        _box2 = dynamic_cast<Part::Box*>(_doc->addObject("Part::Box"));
+        // the boxes overlap, so the fusion has to do some work
+        _box2->Placement.setValue(Base::Placement(Base::Vector3d(5.0, 5.0, 0.0), Base::Rotation()));
+        _doc->recompute();
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    std::vector<App::DocumentObject*> sources() const
+    {
+        return {_box1, _box2};
+    }
+
+    static double volume(const TopoDS_Shape& shape)
+    {
+        GProp_GProps props;
+        BRepGProp::VolumeProperties(shape, props);
+        return props.Mass();
+    }
+
+    App::Document* _doc {};
+    std::string _docName;
+    Part::Box* _box1 {};
+    Part::Box* _box2 {};
+};
+
+TEST_F(ShapeExtractorTest, fusedSourcesAreShared)
+{
+    // Act
+    TopoDS_Shape first = TechDraw::ShapeExtractor::getShapesFused(sources());
+    TopoDS_Shape second = TechDraw::ShapeExtractor::getShapesFused(sources());
+
+    // Assert
+    EXPECT_TRUE(second.IsSame(first));
+    EXPECT_NEAR(volume(first), 1750.0, 1e-6);
+}
+
+TEST_F(ShapeExtractorTest, modifiedSourceIsFusedAgain)
+{
+    // Arrange
+    TopoDS_Shape first = TechDraw::ShapeExtractor::getShapesFused(sources());
+
+    // Act
+    _box2->Height.setValue(20.0);
+    _doc->recompute();
+    TopoDS_Shape second = TechDraw::ShapeExtractor::getShapesFused(sources());
+
+    // Assert
+    EXPECT_FALSE(second.IsSame(first));
+    EXPECT_NEAR(volume(second), 2750.0, 1e-6);
+}
+
+TEST_F(ShapeExtractorTest, movedSourceIsFusedAgain)
+{
+    // Arrange
+    TopoDS_Shape first = TechDraw::ShapeExtractor::getShapesFused(sources());
+
+    // Act
+    _box2->Placement.setValue(Base::Placement(Base::Vector3d(20.0, 0.0, 0.0), Base::Rotation()));
+    _doc->recompute();
+    TopoDS_Shape second = TechDraw::ShapeExtractor::getShapesFused(sources());
+
+    // Assert
+    EXPECT_FALSE(second.IsSame(first));
+    EXPECT_NEAR(volume(second), 2000.0, 1e-6);
+}
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)